@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_HW_BATCH_MATH_H
+#define BN_HW_BATCH_MATH_H
+
+#include "bn_common.h"
+#include "bn_hw_common.h"
+
+namespace bn::hw::batch_math
+{
+    // Matrix: a, b, c, d, translation x, translation y.
+    BN_CODE_IWRAM void transform_2d(const int* matrix, const int* input, int points_count, int* output);
+
+    // Matrix: 3x3 row-major.
+    BN_CODE_IWRAM void transform_3d(const int* matrix, const int* input_xs, const int* input_ys,
+                                    const int* input_zs, int points_count, int* output_xs, int* output_ys,
+                                    int* output_zs);
+
+    BN_CODE_IWRAM void multiply_add(int factor, const int* input, int values_count, int* output);
+
+    [[nodiscard]] BN_CODE_IWRAM int dot(const int* a, const int* b, int values_count);
+
+    BN_CODE_IWRAM void reciprocal(const int* reciprocal_lut, const int* input, int values_count, int* output);
+}
+
+#endif
@@ -28,6 +28,24 @@
  */
 #define BN_CODE_IWRAM __attribute__((section(".iwram")))
 
+/**
+ * @brief Store code in the IWRAM overlay with the given index.
+ *
+ * Overlay indexes must be in the range [0..9].
+ *
+ * Code stored in an IWRAM overlay can be called only after loading it with bn::iwram_overlay::load.
+ */
+#define BN_CODE_IWRAM_OVERLAY(index) __attribute__((section(".iwram" #index)))
+
+/**
+ * @brief Store initialized data in the IWRAM overlay with the given index.
+ *
+ * Overlay indexes must be in the range [0..9].
+ *
+ * Data stored in an IWRAM overlay is reset to its initial value each time the overlay is loaded.
+ */
+#define BN_DATA_IWRAM_OVERLAY(index) __attribute__((section(".iwram" #index)))
+
 /**
  * @brief Store code in EWRAM.
  */
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_HW_IWRAM_OVERLAYS_H
+#define BN_HW_IWRAM_OVERLAYS_H
+
+#include "bn_hw_memory.h"
+
+#ifdef BN_IWRAM_OVERLAY_START
+    extern unsigned BN_IWRAM_OVERLAY_START[];
+    extern unsigned BN_IWRAM_OVERLAY_END[];
+
+    extern unsigned __load_start_iwram0[], __load_stop_iwram0[];
+    extern unsigned __load_start_iwram1[], __load_stop_iwram1[];
+    extern unsigned __load_start_iwram2[], __load_stop_iwram2[];
+    extern unsigned __load_start_iwram3[], __load_stop_iwram3[];
+    extern unsigned __load_start_iwram4[], __load_stop_iwram4[];
+    extern unsigned __load_start_iwram5[], __load_stop_iwram5[];
+    extern unsigned __load_start_iwram6[], __load_stop_iwram6[];
+    extern unsigned __load_start_iwram7[], __load_stop_iwram7[];
+    extern unsigned __load_start_iwram8[], __load_stop_iwram8[];
+    extern unsigned __load_start_iwram9[], __load_stop_iwram9[];
+#endif
+
+namespace bn::hw::iwram_overlays
+{
+    [[nodiscard]] constexpr int count()
+    {
+        return 10;
+    }
+
+    [[nodiscard]] constexpr bool supported()
+    {
+        #ifdef BN_IWRAM_OVERLAY_START
+            return true;
+        #else
+            return false;
+        #endif
+    }
+
+    [[nodiscard]] inline unsigned* region_start()
+    {
+        #ifdef BN_IWRAM_OVERLAY_START
+            return BN_IWRAM_OVERLAY_START;
+        #else
+            return nullptr;
+        #endif
+    }
+
+    [[nodiscard]] inline int region_bytes()
+    {
+        #ifdef BN_IWRAM_OVERLAY_START
+            auto start = reinterpret_cast<uint8_t*>(BN_IWRAM_OVERLAY_START);
+            auto end = reinterpret_cast<uint8_t*>(BN_IWRAM_OVERLAY_END);
+            return end - start;
+        #else
+            return 0;
+        #endif
+    }
+
+    inline void rom_range([[maybe_unused]] int id, const unsigned*& start, const unsigned*& end)
+    {
+        #ifdef BN_IWRAM_OVERLAY_START
+            switch(id)
+            {
+
+            case 0:
+                start = __load_start_iwram0;
+                end = __load_stop_iwram0;
+                break;
+
+            case 1:
+                start = __load_start_iwram1;
+                end = __load_stop_iwram1;
+                break;
+
+            case 2:
+                start = __load_start_iwram2;
+                end = __load_stop_iwram2;
+                break;
+
+            case 3:
+                start = __load_start_iwram3;
+                end = __load_stop_iwram3;
+                break;
+
+            case 4:
+                start = __load_start_iwram4;
+                end = __load_stop_iwram4;
+                break;
+
+            case 5:
+                start = __load_start_iwram5;
+                end = __load_stop_iwram5;
+                break;
+
+            case 6:
+                start = __load_start_iwram6;
+                end = __load_stop_iwram6;
+                break;
+
+            case 7:
+                start = __load_start_iwram7;
+                end = __load_stop_iwram7;
+                break;
+
+            case 8:
+                start = __load_start_iwram8;
+                end = __load_stop_iwram8;
+                break;
+
+            default:
+                start = __load_start_iwram9;
+                end = __load_stop_iwram9;
+                break;
+            }
+        #else
+            start = nullptr;
+            end = nullptr;
+        #endif
+    }
+
+    inline void load(const unsigned* rom_start, int words)
+    {
+        memory::copy_words(rom_start, words, region_start());
+    }
+}
+
+#endif
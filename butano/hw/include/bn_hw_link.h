@@ -23,6 +23,8 @@ namespace bn::hw::link
 
     void init();
 
+    void restore_timer_isr();
+
     [[nodiscard]] bool active();
 
     void enable();
@@ -132,6 +132,27 @@ namespace bn::hw::palettes
         }
     }
 
+    class effects_luts
+    {
+
+    public:
+        alignas(int) uint8_t input[32];
+        alignas(int) uint8_t red_output[32];
+        alignas(int) uint8_t green_output[32];
+        alignas(int) uint8_t blue_output[32];
+        int hue_shift_matrix[9];
+        int grayscale_intensity;
+        bool mixed_channels;
+        bool hue_shift;
+        bool inverted;
+    };
+
+    void build_effects_luts(int brightness, int contrast, int intensity, int hue_shift_intensity, bool inverted,
+                            int grayscale_intensity, color fade_color, int fade_intensity, effects_luts& luts);
+
+    BN_CODE_IWRAM void apply_effects_luts(
+            const color* source_colors_ptr, const effects_luts& luts, int count, color* destination_colors_ptr);
+
     void rotate(const color* source_colors_ptr, int rotate_count, int colors_count, color* destination_colors_ptr);
 
 	void rotate_range(int rotate_count, int colors_count, color* destination_colors_ptr, int rotate_start_index, int rotate_end_index);	
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_HW_SAMPLING_PROFILER_H
+#define BN_HW_SAMPLING_PROFILER_H
+
+#include "bn_config_profiler.h"
+#include "bn_hw_irq.h"
+#include "bn_hw_tonc.h"
+
+namespace bn::hw::sampling_profiler
+{
+    static_assert(BN_CFG_SAMPLING_PROFILER_MAX_ADDRESSES >= 16);
+    static_assert((BN_CFG_SAMPLING_PROFILER_MAX_ADDRESSES & (BN_CFG_SAMPLING_PROFILER_MAX_ADDRESSES - 1)) == 0);
+
+    class entry
+    {
+
+    public:
+        unsigned key;
+        unsigned count;
+    };
+
+    class histogram
+    {
+
+    public:
+        entry entries[BN_CFG_SAMPLING_PROFILER_MAX_ADDRESSES];
+        int samples_count;
+        int lost_samples_count;
+    };
+
+    [[nodiscard]] histogram& data();
+
+    BN_CODE_IWRAM void _intr();
+
+    [[nodiscard]] constexpr int max_entries()
+    {
+        return BN_CFG_SAMPLING_PROFILER_MAX_ADDRESSES;
+    }
+
+    [[nodiscard]] constexpr int ticks_per_second()
+    {
+        return 262144;
+    }
+
+    [[nodiscard]] constexpr unsigned entry_address(unsigned key)
+    {
+        return key & ~1U;
+    }
+
+    // Timer 0 is used by Maxmod and timers 2 and 3 by bn::hw::timer, so timer 1 is shared with link communication:
+    inline void start(int timer_ticks)
+    {
+        REG_TM1CNT = 0;
+        REG_TM1D = uint16_t(65536 - timer_ticks);
+        irq::set_isr(irq::id::TIMER1, _intr);
+        irq::enable(irq::id::TIMER1);
+        REG_TM1CNT = TM_ENABLE | TM_IRQ | TM_FREQ_64;
+    }
+
+    inline void stop()
+    {
+        REG_TM1CNT = 0;
+        irq::disable(irq::id::TIMER1);
+    }
+}
+
+#endif
@@ -7,9 +7,42 @@
 #define BN_HW_TEXT_H
 
 #include "bn_array_fwd.h"
+#include "bn_hw_common.h"
 
 namespace bn::hw::text
 {
+    [[nodiscard]] constexpr int digits_count(unsigned value)
+    {
+        if(value < 100000)
+        {
+            if(value < 100)
+            {
+                return value < 10 ? 1 : 2;
+            }
+
+            if(value < 10000)
+            {
+                return value < 1000 ? 3 : 4;
+            }
+
+            return 5;
+        }
+
+        if(value < 10000000)
+        {
+            return value < 1000000 ? 6 : 7;
+        }
+
+        if(value < 1000000000)
+        {
+            return value < 100000000 ? 8 : 9;
+        }
+
+        return 10;
+    }
+
+    BN_CODE_IWRAM void write_digits(unsigned value, int digits_count, char* output);
+
     [[nodiscard]] int parse(int value, array<char, 32>& output);
 
     [[nodiscard]] int parse(long value, array<char, 32>& output);
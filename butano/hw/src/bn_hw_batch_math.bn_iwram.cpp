@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "../include/bn_hw_batch_math.h"
+
+#include "bn_array.h"
+#include "bn_reciprocal_lut.h"
+
+namespace bn::hw::batch_math
+{
+
+namespace
+{
+    constexpr int precision = 12;
+
+    using reciprocal_lut_value_type = remove_reference_t<decltype(reciprocal_lut)>::value_type;
+
+    // Reciprocal LUT values are converted to fixed_t<16>:
+    constexpr int reciprocal_lut_shift = reciprocal_lut_value_type::precision() - 16;
+
+    static_assert(reciprocal_lut_shift >= 0);
+}
+
+// 64-bit products and sums are compiled to smull and smlal instructions:
+
+void transform_2d(const int* matrix, const int* input, int points_count, int* output)
+{
+    int a = matrix[0];
+    int b = matrix[1];
+    int c = matrix[2];
+    int d = matrix[3];
+    int tx = matrix[4];
+    int ty = matrix[5];
+
+    for(int index = 0; index < points_count; ++index)
+    {
+        int x = input[0];
+        int y = input[1];
+        int64_t output_x = (int64_t(a) * x) + (int64_t(b) * y);
+        int64_t output_y = (int64_t(c) * x) + (int64_t(d) * y);
+        output[0] = int(output_x >> precision) + tx;
+        output[1] = int(output_y >> precision) + ty;
+        input += 2;
+        output += 2;
+    }
+}
+
+void transform_3d(const int* matrix, const int* input_xs, const int* input_ys, const int* input_zs,
+                  int points_count, int* output_xs, int* output_ys, int* output_zs)
+{
+    int m00 = matrix[0];
+    int m01 = matrix[1];
+    int m02 = matrix[2];
+    int m10 = matrix[3];
+    int m11 = matrix[4];
+    int m12 = matrix[5];
+    int m20 = matrix[6];
+    int m21 = matrix[7];
+    int m22 = matrix[8];
+
+    for(int index = 0; index < points_count; ++index)
+    {
+        int x = input_xs[index];
+        int y = input_ys[index];
+        int z = input_zs[index];
+        int64_t output_x = (int64_t(m00) * x) + (int64_t(m01) * y) + (int64_t(m02) * z);
+        int64_t output_y = (int64_t(m10) * x) + (int64_t(m11) * y) + (int64_t(m12) * z);
+        int64_t output_z = (int64_t(m20) * x) + (int64_t(m21) * y) + (int64_t(m22) * z);
+        output_xs[index] = int(output_x >> precision);
+        output_ys[index] = int(output_y >> precision);
+        output_zs[index] = int(output_z >> precision);
+    }
+}
+
+void multiply_add(int factor, const int* input, int values_count, int* output)
+{
+    for(int index = 0; index < values_count; ++index)
+    {
+        output[index] += int((int64_t(factor) * input[index]) >> precision);
+    }
+}
+
+int dot(const int* a, const int* b, int values_count)
+{
+    int64_t result = 0;
+
+    for(int index = 0; index < values_count; ++index)
+    {
+        result += int64_t(a[index]) * b[index];
+    }
+
+    return int(result >> precision);
+}
+
+void reciprocal(const int* reciprocal_lut, const int* input, int values_count, int* output)
+{
+    for(int index = 0; index < values_count; ++index)
+    {
+        int value = input[index];
+        unsigned abs_value = value < 0 ? 0U - unsigned(value) : unsigned(value);
+        int result;
+
+        if(abs_value < reciprocal_lut_size) [[likely]]
+        {
+            result = reciprocal_lut[abs_value] >> reciprocal_lut_shift;
+        }
+        else
+        {
+            result = int(65536U / abs_value);
+        }
+
+        output[index] = value < 0 ? -result : result;
+    }
+}
+
+}
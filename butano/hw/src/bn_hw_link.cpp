@@ -119,6 +119,11 @@ void init()
     data.connection.deactivate();
 }
 
+void restore_timer_isr()
+{
+    irq::set_isr(irq::id::TIMER1, _timer_intr);
+}
+
 bool active()
 {
     return data.active;
@@ -38,4 +38,74 @@ void _lut_effect(const color* source_colors_ptr, const uint8_t* lut, int count,
     }
 }
 
+void apply_effects_luts(const color* source_colors_ptr, const effects_luts& luts, int count,
+                        color* destination_colors_ptr)
+{
+    // LUTs are copied to the stack because EWRAM reads are slower than IWRAM ones:
+    effects_luts stack_luts = luts;
+    const uint8_t* red_output = stack_luts.red_output;
+    const uint8_t* green_output = stack_luts.green_output;
+    const uint8_t* blue_output = stack_luts.blue_output;
+    auto tonc_dst_ptr = reinterpret_cast<COLOR*>(destination_colors_ptr);
+
+    if(! stack_luts.mixed_channels)
+    {
+        for(int index = 0; index < count; ++index)
+        {
+            color color = source_colors_ptr[index];
+            int red = red_output[color.red()];
+            int green = green_output[color.green()];
+            int blue = blue_output[color.blue()];
+            tonc_dst_ptr[index] = RGB15(red, green, blue);
+        }
+
+        return;
+    }
+
+    const uint8_t* input = stack_luts.input;
+    const int* hue_shift_matrix = stack_luts.hue_shift_matrix;
+    int grayscale_intensity = stack_luts.grayscale_intensity;
+    bool hue_shift = stack_luts.hue_shift;
+    bool inverted = stack_luts.inverted;
+
+    for(int index = 0; index < count; ++index)
+    {
+        color color = source_colors_ptr[index];
+        int red = input[color.red()];
+        int green = input[color.green()];
+        int blue = input[color.blue()];
+
+        if(hue_shift)
+        {
+            int shifted_red = ((red * hue_shift_matrix[0]) + (green * hue_shift_matrix[1]) +
+                    (blue * hue_shift_matrix[2])) >> 12;
+            int shifted_green = ((red * hue_shift_matrix[3]) + (green * hue_shift_matrix[4]) +
+                    (blue * hue_shift_matrix[5])) >> 12;
+            int shifted_blue = ((red * hue_shift_matrix[6]) + (green * hue_shift_matrix[7]) +
+                    (blue * hue_shift_matrix[8])) >> 12;
+            red = bn::clamp(shifted_red, 0, 31);
+            green = bn::clamp(shifted_green, 0, 31);
+            blue = bn::clamp(shifted_blue, 0, 31);
+        }
+
+        if(inverted)
+        {
+            red = 31 - red;
+            green = 31 - green;
+            blue = 31 - blue;
+        }
+
+        if(grayscale_intensity)
+        {
+            // Same rounding as clr_grayscale and clr_blend_fast:
+            int gray = ((red * 0x4C) + (green * 0x96) + (blue * 0x1E) + 0x80) >> 8;
+            red = ((red * 32) + ((gray - red) * grayscale_intensity) + 16) >> 5;
+            green = ((green * 32) + ((gray - green) * grayscale_intensity) + 16) >> 5;
+            blue = ((blue * 32) + ((gray - blue) * grayscale_intensity) + 16) >> 5;
+        }
+
+        tonc_dst_ptr[index] = RGB15(red_output[red], green_output[green], blue_output[blue]);
+    }
+}
+
 }
@@ -136,6 +136,66 @@ void hue_shift(const color* source_colors_ptr, int value, int count, color* dest
     }
 }
 
+void build_effects_luts(int brightness, int contrast, int intensity, int hue_shift_intensity, bool inverted,
+                        int grayscale_intensity, color fade_color, int fade_intensity, effects_luts& luts)
+{
+    // Channel mixing effects (hue shift and grayscale) split the LUTs in input and output ones:
+    bool mixed_channels = hue_shift_intensity || grayscale_intensity;
+    bool input_inverted = inverted && ! hue_shift_intensity;
+    bool output_inverted = inverted && hue_shift_intensity && ! grayscale_intensity;
+    const uint8_t* contrast_lut_ptr = contrast_lut.data() + (contrast * 32);
+    const uint8_t* intensity_lut_ptr = intensity_lut.data() + (intensity * 32);
+    int fade_red = fade_color.red();
+    int fade_green = fade_color.green();
+    int fade_blue = fade_color.blue();
+    luts.mixed_channels = mixed_channels;
+    luts.hue_shift = hue_shift_intensity;
+    luts.inverted = inverted && hue_shift_intensity && grayscale_intensity;
+    luts.grayscale_intensity = grayscale_intensity;
+
+    for(int index = 0; index < 9; ++index)
+    {
+        // Same precision loss as fixed multiplication:
+        int half_scale = fixed::half_scale();
+        luts.hue_shift_matrix[index] = (hue_shift_lut[(hue_shift_intensity * 9) + index].data() / half_scale) *
+                half_scale;
+    }
+
+    for(int index = 0; index < 32; ++index)
+    {
+        int input = bn::min(index + brightness, 31);
+
+        if(contrast)
+        {
+            input = contrast_lut_ptr[input];
+        }
+
+        if(intensity)
+        {
+            input = intensity_lut_ptr[input];
+        }
+
+        if(input_inverted)
+        {
+            input = 31 - input;
+        }
+
+        luts.input[index] = uint8_t(input);
+
+        int output = mixed_channels ? index : input;
+
+        if(output_inverted)
+        {
+            output = 31 - output;
+        }
+
+        // Same rounding as clr_fade_fast:
+        luts.red_output[index] = uint8_t(((output * 32) + ((fade_red - output) * fade_intensity) + 16) >> 5);
+        luts.green_output[index] = uint8_t(((output * 32) + ((fade_green - output) * fade_intensity) + 16) >> 5);
+        luts.blue_output[index] = uint8_t(((output * 32) + ((fade_blue - output) * fade_intensity) + 16) >> 5);
+    }
+}
+
 void rotate(const color* source_colors_ptr, int rotate_count, int colors_count, color* destination_colors_ptr)
 {
     int destination_index = rotate_count;
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "../include/bn_hw_sampling_profiler.h"
+
+#if BN_CFG_SAMPLING_PROFILER_ENABLED
+    namespace bn::hw::sampling_profiler
+    {
+        namespace
+        {
+            constexpr int max_probes = 16;
+
+            constexpr int _hash_shift()
+            {
+                int result = 32;
+
+                for(int value = max_entries(); value > 1; value >>= 1)
+                {
+                    --result;
+                }
+
+                return result;
+            }
+
+            BN_DATA_EWRAM_BSS histogram histogram_data;
+        }
+
+        histogram& data()
+        {
+            return histogram_data;
+        }
+
+        void _intr()
+        {
+            // The BIOS pushes r0-r3, r12 and lr to the IRQ stack, and then the global interrupt handler
+            // pushes the previous IME, spsr and lr, so the interrupted lr is stored at SP_irq + 32:
+            unsigned* irq_stack;
+
+            asm volatile(
+                "mrs r2, cpsr\n"
+                "bic r3, r2, #0x1F\n"
+                "orr r3, r3, #0x92\n"
+                "msr cpsr_c, r3\n"
+                "mov %0, sp\n"
+                "msr cpsr_c, r2\n"
+                : "=r" (irq_stack) : : "r2", "r3");
+
+            unsigned key = (irq_stack[8] - 4) | 1;
+            unsigned index = ((key >> 1) * 0x9E3779B1) >> _hash_shift();
+            constexpr unsigned index_mask = max_entries() - 1;
+            entry* entries = histogram_data.entries;
+            ++histogram_data.samples_count;
+
+            for(int probe = 0; probe < max_probes; ++probe)
+            {
+                entry& current_entry = entries[index];
+                unsigned current_key = current_entry.key;
+
+                if(current_key == key)
+                {
+                    ++current_entry.count;
+                    return;
+                }
+
+                if(! current_key)
+                {
+                    current_entry.key = key;
+                    current_entry.count = 1;
+                    return;
+                }
+
+                index = (index + 1) & index_mask;
+            }
+
+            ++histogram_data.lost_samples_count;
+        }
+    }
+#endif
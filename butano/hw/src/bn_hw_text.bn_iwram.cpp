@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "../include/bn_hw_text.h"
+
+namespace bn::hw::text
+{
+
+namespace
+{
+    constexpr char digit_pairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+}
+
+void write_digits(unsigned value, int digits_count, char* output)
+{
+    // Divisions by 100 and 10 are replaced by reciprocal multiplications (exact for all 32-bit values):
+    char* current_output = output + digits_count;
+
+    while(current_output - output >= 2)
+    {
+        auto quotient = unsigned((uint64_t(value) * 0x51EB851FU) >> 37);
+        const char* digit_pair = digit_pairs + ((value - (quotient * 100)) * 2);
+        current_output -= 2;
+        current_output[0] = digit_pair[0];
+        current_output[1] = digit_pair[1];
+        value = quotient;
+    }
+
+    if(current_output != output)
+    {
+        auto quotient = unsigned((uint64_t(value) * 0xCCCCCCCDU) >> 35);
+        *output = char('0' + (value - (quotient * 10)));
+    }
+}
+
+}
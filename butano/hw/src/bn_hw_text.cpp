@@ -5,7 +5,6 @@
 
 #include "../include/bn_hw_text.h"
 
-#include "bn_math.h"
 #include "bn_array.h"
 #include "bn_string_view.h"
 
@@ -19,183 +18,72 @@ namespace bn::hw::text
 
 namespace
 {
-    template<typename Type>
-    [[nodiscard]] int _to_string(Type value, char* output_data)
+    [[nodiscard]] int _parse(unsigned value, char* output_data)
     {
-        if(value < 0)
-        {
-            *output_data = '-';
-            ++output_data;
-            return _to_string(-value, output_data) + 1;
-        }
-
-        array<char, 16> extra_array;
-        char* extra_data = extra_array.data();
-        char* current_extra_data = extra_data;
+        int size = digits_count(value);
+        write_digits(value, size, output_data);
+        output_data[size] = 0;
+        return size;
+    }
 
-        do
+    [[nodiscard]] int _parse(uint64_t value, char* output_data)
+    {
+        if(value <= 0xFFFFFFFF)
         {
-            auto digit = int(value % 10);
-            value /= 10;
-            *current_extra_data = char('0' + digit);
-            ++current_extra_data;
+            return _parse(unsigned(value), output_data);
         }
-        while(value >= 500000000);
 
-        posprintf(output_data, "%l", long(value));
+        constexpr unsigned low_divisor = 1000000000;
+        constexpr int low_digits_count = 9;
 
-        int size = string_view(output_data).size();
-        int extra_size = current_extra_data - extra_data;
+        int size = _parse(value / low_divisor, output_data);
+        write_digits(unsigned(value % low_divisor), low_digits_count, output_data + size);
+        size += low_digits_count;
+        output_data[size] = 0;
+        return size;
+    }
 
-        for(int index = extra_size - 1; index >= 0; --index)
+    template<typename Type, typename UnsignedType>
+    [[nodiscard]] int _parse_signed(Type value, char* output_data)
+    {
+        if(value < 0)
         {
-            output_data[size] = extra_data[index];
-            ++size;
+            *output_data = '-';
+            return _parse(UnsignedType(0) - UnsignedType(value), output_data + 1) + 1;
         }
 
-        return size;
+        return _parse(UnsignedType(value), output_data);
     }
 }
 
 int parse(int value, array<char, 32>& output)
 {
-    char* output_data = output.data();
-    int abs_value = abs(value);
-    int size;
-
-    if(abs_value < 65536)
-    {
-        posprintf(output_data, "%d", value);
-        size = string_view(output_data).size();
-    }
-    else if(abs_value < 500000000)
-    {
-        posprintf(output_data, "%l", long(value));
-        size = string_view(output_data).size();
-    }
-    else
-    {
-        size = _to_string(value, output_data);
-    }
-
-    return size;
+    return _parse_signed<int, unsigned>(value, output.data());
 }
 
 int parse(long value, array<char, 32>& output)
 {
-    char* output_data = output.data();
-    long abs_value = abs(value);
-    int size;
-
-    if(abs_value < 65536)
-    {
-        posprintf(output_data, "%d", int(value));
-        size = string_view(output_data).size();
-    }
-    else if(abs_value < 500000000)
-    {
-        posprintf(output_data, "%l", value);
-        size = string_view(output_data).size();
-    }
-    else
-    {
-        size = _to_string(value, output_data);
-    }
-
-    return size;
+    return _parse_signed<long, unsigned>(value, output.data());
 }
 
 int parse(int64_t value, array<char, 32>& output)
 {
-    char* output_data = output.data();
-    int64_t abs_value = abs(value);
-    int size;
-
-    if(abs_value < 65536)
-    {
-        posprintf(output_data, "%d", int(value));
-        size = string_view(output_data).size();
-    }
-    else if(abs_value < 500000000)
-    {
-        posprintf(output_data, "%l", long(value));
-        size = string_view(output_data).size();
-    }
-    else
-    {
-        size = _to_string(value, output_data);
-    }
-
-    return size;
+    return _parse_signed<int64_t, uint64_t>(value, output.data());
 }
 
 int parse(unsigned value, array<char, 32>& output)
 {
-    char* output_data = output.data();
-    int size;
-
-    if(value < 65536)
-    {
-        posprintf(output_data, "%d", int(value));
-        size = string_view(output_data).size();
-    }
-    else if(value < 500000000)
-    {
-        posprintf(output_data, "%l", long(value));
-        size = string_view(output_data).size();
-    }
-    else
-    {
-        size = _to_string(value, output_data);
-    }
-
-    return size;
+    return _parse(value, output.data());
 }
 
 int parse(unsigned long value, array<char, 32>& output)
 {
-    char* output_data = output.data();
-    int size;
-
-    if(value < 65536)
-    {
-        posprintf(output_data, "%d", int(value));
-        size = string_view(output_data).size();
-    }
-    else if(value < 500000000)
-    {
-        posprintf(output_data, "%l", long(value));
-        size = string_view(output_data).size();
-    }
-    else
-    {
-        size = _to_string(value, output_data);
-    }
-
-    return size;
+    return _parse(unsigned(value), output.data());
 }
 
 int parse(uint64_t value, array<char, 32>& output)
 {
-    char* output_data = output.data();
-    int size;
-
-    if(value < 65536)
-    {
-        posprintf(output_data, "%d", int(value));
-        size = string_view(output_data).size();
-    }
-    else if(value < 500000000)
-    {
-        posprintf(output_data, "%l", long(value));
-        size = string_view(output_data).size();
-    }
-    else
-    {
-        size = _to_string(value, output_data);
-    }
-
-    return size;
+    return _parse(value, output.data());
 }
 
 int parse(const void* ptr, array<char, 32>& output)
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_BATCH_MATH_H
+#define BN_BATCH_MATH_H
+
+/**
+ * @file
+ * bn::batch_math header file.
+ *
+ * @ingroup math
+ */
+
+#include "bn_span.h"
+#include "bn_fixed_point.h"
+
+/**
+ * @brief Fixed point math functions which process arrays of values at once.
+ *
+ * They are placed in IWRAM and compiled as ARM code, so they are faster than equivalent loops of scalar operations
+ * when processing many values (particles, vertices, etc).
+ *
+ * Products are calculated with 64-bit precision and shifted right (rounded towards negative infinity),
+ * so they don't overflow like fixed::unsafe_multiplication.
+ *
+ * Input and output spans can reference the same values.
+ *
+ * @ingroup math
+ */
+namespace bn::batch_math
+{
+    /**
+     * @brief Transforms the given points with a 2x2 matrix and a translation.
+     * @param a Horizontal component of the matrix first row.
+     * @param b Vertical component of the matrix first row.
+     * @param c Horizontal component of the matrix second row.
+     * @param d Vertical component of the matrix second row.
+     * @param translation Translation added to each transformed point.
+     * @param input Points to transform.
+     * @param output Transformed points (x' = a * x + b * y + tx, y' = c * x + d * y + ty).
+     * Its size must be equal to the size of the input span.
+     */
+    void transform(fixed a, fixed b, fixed c, fixed d, const fixed_point& translation,
+                   const span<const fixed_point>& input, span<fixed_point> output);
+
+    /**
+     * @brief Transforms the given 3D points with a 3x3 matrix.
+     * @param matrix 3x3 row-major matrix.
+     * @param input_xs Horizontal coordinates of the points to transform.
+     * @param input_ys Vertical coordinates of the points to transform.
+     * @param input_zs Depth coordinates of the points to transform.
+     * @param output_xs Horizontal coordinates of the transformed points.
+     * @param output_ys Vertical coordinates of the transformed points.
+     * @param output_zs Depth coordinates of the transformed points.
+     *
+     * All spans must have the same size.
+     */
+    void transform(const span<const fixed>& matrix, const span<const fixed>& input_xs,
+                   const span<const fixed>& input_ys, const span<const fixed>& input_zs,
+                   span<fixed> output_xs, span<fixed> output_ys, span<fixed> output_zs);
+
+    /**
+     * @brief Rotates the given points around the origin.
+     * @param degrees_angle Rotation angle in degrees, in the range [0..360].
+     * @param input Points to rotate.
+     * @param output Rotated points (x' = x * cos - y * sin, y' = x * sin + y * cos).
+     * Its size must be equal to the size of the input span.
+     */
+    void rotate(fixed degrees_angle, const span<const fixed_point>& input, span<fixed_point> output);
+
+    /**
+     * @brief Scales the given points from the origin.
+     * @param scale Scale factor.
+     * @param input Points to scale.
+     * @param output Scaled points. Its size must be equal to the size of the input span.
+     */
+    void scale(fixed scale, const span<const fixed_point>& input, span<fixed_point> output);
+
+    /**
+     * @brief Multiplies the given points by a factor and adds the result to the output points
+     * (for example, to update positions from velocities).
+     * @param factor Multiplication factor.
+     * @param input Points to multiply.
+     * @param output Points to add the multiplied input points to.
+     * Its size must be equal to the size of the input span.
+     */
+    void multiply_add(fixed factor, const span<const fixed_point>& input, span<fixed_point> output);
+
+    /**
+     * @brief Multiplies the given values by a factor and adds the result to the output values.
+     * @param factor Multiplication factor.
+     * @param input Values to multiply.
+     * @param output Values to add the multiplied input values to.
+     * Its size must be equal to the size of the input span.
+     */
+    void multiply_add(fixed factor, const span<const fixed>& input, span<fixed> output);
+
+    /**
+     * @brief Returns the sum of the products of the given values (dot product).
+     * @param a First values to multiply.
+     * @param b Second values to multiply. Its size must be equal to the size of the first span.
+     */
+    [[nodiscard]] fixed dot(const span<const fixed>& a, const span<const fixed>& b);
+
+    /**
+     * @brief Calculates the reciprocal of the given non zero integer values.
+     *
+     * Values in the range [-reciprocal_lut_size + 1, reciprocal_lut_size - 1] are retrieved from reciprocal_lut.
+     *
+     * @param input Non zero values.
+     * @param output Reciprocal of each input value (1 / value) in 16.16 format.
+     * Its size must be equal to the size of the input span.
+     */
+    void reciprocal(const span<const int>& input, span<fixed_t<16>> output);
+}
+
+#endif
@@ -14,6 +14,7 @@
  */
 
 #include "bn_fixed.h"
+#include "bn_tween_system.h"
 #include "bn_bg_palette_ptr.h"
 #include "bn_value_template_actions.h"
 
@@ -750,6 +751,20 @@ public:
 
 
 
+/**
+ * @brief Modifies the intensity of the fade effect applied to multiple bg_palette_ptr objects
+ * until they have given states, following easing curves.
+ *
+ * @tparam MaxSize Maximum number of tweens.
+ *
+ * @ingroup bg
+ * @ingroup palette
+ * @ingroup action
+ */
+template<int MaxSize>
+using bg_palette_fade_tween_system = tween_system<bg_palette_ptr, fixed, bg_palette_fade_manager, MaxSize>;
+
+
 // rotate
 
 /**
@@ -68,7 +68,26 @@ public:
      * @param compression Compression type.
      */
     constexpr bg_palette_item(const span<const color>& colors_ref, bpp_mode bpp, compression_type compression) :
+        bg_palette_item(colors_ref, bpp, compression, 0)
+    {
+    }
+
+    /**
+     * @brief Constructor.
+     * @param colors_ref Reference to an array of multiples of 16 colors.
+     *
+     * The colors are not copied but referenced, so they should outlive the bg_palette_item
+     * to avoid dangling references.
+     *
+     * @param bpp Bits per pixel of the color palettes to create.
+     * @param compression Compression type.
+     * @param colors_hash Hash of the uncompressed colors generated by the assets conversion tools
+     * (0 if it must be calculated when needed).
+     */
+    constexpr bg_palette_item(const span<const color>& colors_ref, bpp_mode bpp, compression_type compression,
+                              unsigned colors_hash) :
         _colors_ref(colors_ref),
+        _colors_hash(colors_hash),
         _bpp(bpp),
         _compression(compression)
     {
@@ -103,6 +122,17 @@ public:
         return _compression;
     }
 
+    /**
+     * @brief Returns the hash of the uncompressed colors generated by the assets conversion tools
+     * (0 if it must be calculated when needed).
+     *
+     * It allows to find already created 4BPP color palettes with the same colors without calculating a hash at runtime.
+     */
+    [[nodiscard]] constexpr unsigned colors_hash() const
+    {
+        return _colors_hash;
+    }
+
     /**
      * @brief Decompresses the stored data in the colors referenced by decompressed_colors_ref.
      *
@@ -157,6 +187,7 @@ public:
 
 private:
     span<const color> _colors_ref;
+    unsigned _colors_hash;
     bpp_mode _bpp;
     compression_type _compression;
 };
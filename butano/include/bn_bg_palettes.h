@@ -40,6 +40,17 @@ namespace bn::bg_palettes
      */
     [[nodiscard]] int available_colors_count();
 
+    /**
+     * @brief Returns the number of times an existing 4BPP background color palette has been reused
+     * instead of creating a new one with the same colors.
+     */
+    [[nodiscard]] int reused_palettes_count();
+
+    /**
+     * @brief Returns the number of 4BPP background color palettes that have been created.
+     */
+    [[nodiscard]] int created_palettes_count();
+
     /**
      * @brief Returns the overridden transparent color of the backgrounds if any, bn::nullopt otherwise.
      */
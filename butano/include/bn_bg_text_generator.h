@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_BG_TEXT_GENERATOR_H
+#define BN_BG_TEXT_GENERATOR_H
+
+/**
+ * @file
+ * bn::bg_text_generator header file.
+ *
+ * @ingroup regular_bg
+ * @ingroup text
+ */
+
+#include "bn_unordered_map.h"
+#include "bn_regular_bg_map_ptr.h"
+#include "bn_sprite_text_generator.h"
+
+namespace bn
+{
+
+/**
+ * @brief Prints text in the cells of a regular background map allocated in VRAM from a given sprite_font.
+ *
+ * The map is 32x32 cells (256x256 pixels) and each line of text takes one (8 pixels high fonts)
+ * or two (16 pixels high fonts) rows of map cells.
+ *
+ * Tiles are composed on the fly (so variable width fonts are supported) and identical tiles are shared
+ * between all map cells that reference them. Tiles that are no longer referenced are released before printing
+ * a line of text, so reprinting it doesn't need the tiles of both the old and the new text.
+ *
+ * Only changed map rows are copied to VRAM.
+ *
+ * Since this class holds a copy of the map cells, it should be allocated in EWRAM (with bn::unique_ptr for example).
+ *
+ * @ingroup regular_bg
+ * @ingroup text
+ */
+class bg_text_generator
+{
+
+public:
+    using alignment_type = sprite_text_generator::alignment_type; //!< Horizontal alignment type alias.
+
+    static constexpr int columns = 32; //!< Number of columns of the output map.
+    static constexpr int rows = 32; //!< Number of rows of the output map.
+    static constexpr int max_tiles = 256; //!< Maximum number of tiles that can be referenced by the output map.
+
+    /**
+     * @brief Constructor.
+     * @param font Sprite font for drawing text.
+     * @param tiles_count Number of tiles to allocate in VRAM for the output map, in the range [2..max_tiles].
+     */
+    explicit bg_text_generator(const sprite_font& font, int tiles_count = max_tiles);
+
+    bg_text_generator(const bg_text_generator& other) = delete;
+
+    bg_text_generator& operator=(const bg_text_generator& other) = delete;
+
+    /**
+     * @brief Returns the sprite font for drawing text.
+     */
+    [[nodiscard]] const sprite_font& font() const
+    {
+        return _font;
+    }
+
+    /**
+     * @brief Returns the output map.
+     */
+    [[nodiscard]] const regular_bg_map_ptr& map() const
+    {
+        return _map;
+    }
+
+    /**
+     * @brief Returns the horizontal alignment of the output text.
+     */
+    [[nodiscard]] alignment_type alignment() const
+    {
+        return _alignment;
+    }
+
+    /**
+     * @brief Sets the horizontal alignment of the output text.
+     */
+    void set_alignment(alignment_type alignment)
+    {
+        _alignment = alignment;
+    }
+
+    /**
+     * @brief Returns the number of rows of map cells taken by each line of text.
+     */
+    [[nodiscard]] int line_rows() const
+    {
+        return _line_rows;
+    }
+
+    /**
+     * @brief Returns the width in pixels of the given text.
+     */
+    [[nodiscard]] int width(const string_view& text) const;
+
+    /**
+     * @brief Replaces the contents of the map rows taken by a line of text with the given single line of text.
+     * @param x Horizontal position in pixels of the text in the map, considering the current alignment.
+     * @param row Index of the first map row of the line of text, in the range [0..rows - line_rows()].
+     * @param text Single line of text to print. Characters outside of the map are not printed.
+     */
+    void print(int x, int row, const string_view& text);
+
+    /**
+     * @brief Clears the map rows taken by the line of text which starts in the given row.
+     * @param row Index of the first map row of the line of text, in the range [0..rows - line_rows()].
+     */
+    void clear(int row);
+
+    /**
+     * @brief Clears all map cells.
+     */
+    void clear();
+
+    /**
+     * @brief Returns the number of different tiles referenced by the map (including the empty one).
+     */
+    [[nodiscard]] int used_tiles_count() const
+    {
+        return _tiles_count - _free_tiles.size();
+    }
+
+    /**
+     * @brief Returns the number of tiles copied to VRAM by the last print or clear call.
+     */
+    [[nodiscard]] int last_updated_tiles_count() const
+    {
+        return _last_updated_tiles_count;
+    }
+
+    /**
+     * @brief Returns the number of map rows copied to VRAM by the last print or clear call.
+     */
+    [[nodiscard]] int last_updated_rows_count() const
+    {
+        return _last_updated_rows_count;
+    }
+
+private:
+    sprite_font _font;
+    regular_bg_map_ptr _map;
+    tile* _tiles_vram;
+    regular_bg_map_cell* _map_vram;
+    unordered_map<unsigned, uint16_t, max_tiles * 2> _tiles_map;
+    vector<uint16_t, max_tiles> _free_tiles;
+    unsigned _tile_hashes[max_tiles];
+    uint16_t _tile_usages[max_tiles];
+    regular_bg_map_cell _cells[columns * rows];
+    regular_bg_map_cell _empty_cell;
+    int16_t _tiles_offset;
+    int16_t _tiles_count;
+    int _last_updated_tiles_count = 0;
+    int _last_updated_rows_count = 0;
+    alignment_type _alignment = alignment_type::LEFT;
+    int8_t _line_rows;
+
+    [[nodiscard]] regular_bg_map_cell _acquire_tile(const tile& tile_data);
+
+    void _release_rows(int row);
+
+    void _commit_rows(int row, const regular_bg_map_cell* new_cells);
+};
+
+}
+
+#endif
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_CONFIG_FRAME_ARENA_H
+#define BN_CONFIG_FRAME_ARENA_H
+
+/**
+ * @file
+ * Frame arena configuration header file.
+ *
+ * @ingroup memory
+ */
+
+#include "bn_common.h"
+
+/**
+ * @def BN_CFG_FRAME_ARENA_IWRAM_BYTES
+ *
+ * Specifies the size in bytes of the IWRAM frame arena.
+ *
+ * It must be a multiple of 4.
+ *
+ * By default it is zero, so the IWRAM frame arena can't be used and it takes almost no memory.
+ *
+ * @ingroup memory
+ */
+#ifndef BN_CFG_FRAME_ARENA_IWRAM_BYTES
+    #define BN_CFG_FRAME_ARENA_IWRAM_BYTES 0
+#endif
+
+/**
+ * @def BN_CFG_FRAME_ARENA_EWRAM_BYTES
+ *
+ * Specifies the size in bytes of the EWRAM frame arena.
+ *
+ * It must be a multiple of 4.
+ *
+ * By default it is zero, so the EWRAM frame arena can't be used and it takes almost no memory.
+ *
+ * @ingroup memory
+ */
+#ifndef BN_CFG_FRAME_ARENA_EWRAM_BYTES
+    #define BN_CFG_FRAME_ARENA_EWRAM_BYTES 0
+#endif
+
+#endif
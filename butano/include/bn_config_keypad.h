@@ -26,4 +26,15 @@
     #define BN_CFG_KEYPAD_LOG_ENABLED false
 #endif
 
+/**
+ * @def BN_CFG_KEYPAD_COMMANDS
+ *
+ * Keypad commands recorded with the keypad logger replayed when bn::core::init is called without keypad commands.
+ *
+ * @ingroup keypad
+ */
+#ifndef BN_CFG_KEYPAD_COMMANDS
+    #define BN_CFG_KEYPAD_COMMANDS ""
+#endif
+
 #endif
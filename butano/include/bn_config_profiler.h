@@ -61,4 +61,45 @@
     #define BN_CFG_PROFILER_MAX_ENTRIES 64
 #endif
 
+/**
+ * @def BN_CFG_PROFILER_LOG_FRAMES
+ *
+ * If it is greater than zero, profiling results are logged with bn::profiler::log
+ * when bn::core::update has been called the specified number of times.
+ *
+ * It allows to retrieve profiling results from headless emulators without modifying the profiled project.
+ *
+ * @ingroup profiler
+ */
+#ifndef BN_CFG_PROFILER_LOG_FRAMES
+    #define BN_CFG_PROFILER_LOG_FRAMES 0
+#endif
+
+/**
+ * @def BN_CFG_SAMPLING_PROFILER_ENABLED
+ *
+ * Specifies if the sampling profiler is enabled or not.
+ *
+ * The sampling profiler uses the hardware timer 1, which is shared with link communication,
+ * so link communication can't be used while it is running.
+ *
+ * @ingroup profiler
+ */
+#ifndef BN_CFG_SAMPLING_PROFILER_ENABLED
+    #define BN_CFG_SAMPLING_PROFILER_ENABLED false
+#endif
+
+/**
+ * @def BN_CFG_SAMPLING_PROFILER_MAX_ADDRESSES
+ *
+ * Specifies the maximum number of different code addresses that can be recorded by the sampling profiler.
+ *
+ * It must be a power of two. Each address takes 8 bytes of EWRAM.
+ *
+ * @ingroup profiler
+ */
+#ifndef BN_CFG_SAMPLING_PROFILER_MAX_ADDRESSES
+    #define BN_CFG_SAMPLING_PROFILER_MAX_ADDRESSES 2048
+#endif
+
 #endif
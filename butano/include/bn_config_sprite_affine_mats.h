@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_CONFIG_SPRITE_AFFINE_MATS_H
+#define BN_CONFIG_SPRITE_AFFINE_MATS_H
+
+/**
+ * @file
+ * Sprite affine mats configuration header file.
+ *
+ * @ingroup sprite
+ * @ingroup affine_mat
+ */
+
+#include "bn_common.h"
+
+/**
+ * @def BN_CFG_SPRITE_AFFINE_MATS_SHARED_ROTATION_ANGLE_STEP
+ *
+ * Specifies the step in degrees to which the rotation angle of shared sprite affine mats is rounded.
+ *
+ * Bigger steps allow more sprites to share the same affine mat at the cost of rotation precision.
+ *
+ * @ingroup sprite
+ * @ingroup affine_mat
+ */
+#ifndef BN_CFG_SPRITE_AFFINE_MATS_SHARED_ROTATION_ANGLE_STEP
+    #define BN_CFG_SPRITE_AFFINE_MATS_SHARED_ROTATION_ANGLE_STEP 5.625
+#endif
+
+/**
+ * @def BN_CFG_SPRITE_AFFINE_MATS_SHARED_SCALE_STEP
+ *
+ * Specifies the step to which the horizontal and vertical scales of shared sprite affine mats are rounded.
+ *
+ * Bigger steps allow more sprites to share the same affine mat at the cost of scale precision.
+ *
+ * @ingroup sprite
+ * @ingroup affine_mat
+ */
+#ifndef BN_CFG_SPRITE_AFFINE_MATS_SHARED_SCALE_STEP
+    #define BN_CFG_SPRITE_AFFINE_MATS_SHARED_SCALE_STEP 0.0625
+#endif
+
+#endif
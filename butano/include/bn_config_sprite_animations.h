@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_CONFIG_SPRITE_ANIMATIONS_H
+#define BN_CONFIG_SPRITE_ANIMATIONS_H
+
+/**
+ * @file
+ * Sprite animations configuration header file.
+ *
+ * @ingroup sprite
+ * @ingroup action
+ */
+
+#include "bn_common.h"
+
+/**
+ * @def BN_CFG_SPRITE_ANIMATIONS_MAX_ITEMS
+ *
+ * Specifies the maximum number of sprite animations that can be created with
+ * bn::sprite_animation_ptr static constructors.
+ *
+ * @ingroup sprite
+ * @ingroup action
+ */
+#ifndef BN_CFG_SPRITE_ANIMATIONS_MAX_ITEMS
+    #define BN_CFG_SPRITE_ANIMATIONS_MAX_ITEMS 32
+#endif
+
+/**
+ * @def BN_CFG_SPRITE_ANIMATIONS_MAX_FRAMES
+ *
+ * Specifies the maximum number of frames of each sprite animation.
+ *
+ * @ingroup sprite
+ * @ingroup action
+ */
+#ifndef BN_CFG_SPRITE_ANIMATIONS_MAX_FRAMES
+    #define BN_CFG_SPRITE_ANIMATIONS_MAX_FRAMES 16
+#endif
+
+#endif
@@ -27,6 +27,20 @@
     #define BN_CFG_SPRITE_TILES_MAX_ITEMS 128
 #endif
 
+/**
+ * @def BN_CFG_SPRITE_TILES_COMPACTION_BYTES_PER_FRAME
+ *
+ * Specifies the default maximum number of bytes of sprite tiles that can be moved in VRAM per frame
+ * to reduce its fragmentation.
+ *
+ * If it is zero, sprite tiles are never moved.
+ *
+ * @ingroup sprite
+ */
+#ifndef BN_CFG_SPRITE_TILES_COMPACTION_BYTES_PER_FRAME
+    #define BN_CFG_SPRITE_TILES_COMPACTION_BYTES_PER_FRAME 0
+#endif
+
 /**
  * @def BN_CFG_SPRITE_TILES_LOG_ENABLED
  *
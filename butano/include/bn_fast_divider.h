@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_FAST_DIVIDER_H
+#define BN_FAST_DIVIDER_H
+
+/**
+ * @file
+ * bn::fast_divider header file.
+ *
+ * @ingroup math
+ */
+
+#include "bn_fixed.h"
+#include "bn_assert.h"
+
+namespace bn
+{
+
+/**
+ * @brief Divides values by the same integer divisor with a multiplication and a shift
+ * instead of calling integer division routines.
+ *
+ * The magic number and the shift used to replace the division are calculated in the constructor
+ * (which calls an integer division routine), so a fast_divider should be created once
+ * and used to divide multiple values. If possible, it should be created at compile time.
+ *
+ * Results are exactly the same as the ones returned by the division operator (they are rounded toward zero).
+ *
+ * See https://gmplib.org/~tege/divcnst-pldi94.pdf
+ *
+ * @ingroup math
+ */
+class fast_divider
+{
+
+public:
+    /**
+     * @brief Constructor.
+     * @param divisor Valid divisor (!= 0).
+     */
+    constexpr explicit fast_divider(int divisor) :
+        _divisor(divisor)
+    {
+        BN_ASSERT(divisor, "Divisor is zero");
+
+        unsigned abs_divisor = _abs(divisor);
+        int floor_log_2 = 31 - __builtin_clz(abs_divisor);
+        _shift = uint8_t(floor_log_2);
+
+        if(abs_divisor & (abs_divisor - 1))
+        {
+            uint64_t power = uint64_t(1) << (32 + floor_log_2);
+            auto magic = unsigned(power / abs_divisor);
+            auto remainder = unsigned(power % abs_divisor);
+
+            if(abs_divisor - remainder >= (1U << floor_log_2))
+            {
+                // The magic number needs 33 bits, so the 33th bit is handled with an add indicator:
+                unsigned twice_remainder = remainder + remainder;
+                magic += magic;
+
+                if(twice_remainder >= abs_divisor || twice_remainder < remainder)
+                {
+                    ++magic;
+                }
+
+                _add = true;
+            }
+
+            _magic = magic + 1;
+        }
+    }
+
+    /**
+     * @brief Returns the divisor.
+     */
+    [[nodiscard]] constexpr int divisor() const
+    {
+        return _divisor;
+    }
+
+    /**
+     * @brief Returns the division of the given unsigned value by the absolute value of the divisor.
+     */
+    [[nodiscard]] constexpr unsigned divide_abs(unsigned value) const
+    {
+        if(! _magic)
+        {
+            return value >> _shift;
+        }
+
+        auto result = unsigned((uint64_t(value) * _magic) >> 32);
+
+        if(_add)
+        {
+            result += (value - result) >> 1;
+        }
+
+        return result >> _shift;
+    }
+
+    /**
+     * @brief Returns the division of the given value by the divisor.
+     */
+    [[nodiscard]] constexpr int divide(int value) const
+    {
+        int abs_result = int(divide_abs(_abs(value)));
+        return (value ^ _divisor) < 0 ? -abs_result : abs_result;
+    }
+
+    /**
+     * @brief Returns the division of the given fixed point value by the divisor.
+     */
+    template<int Precision>
+    [[nodiscard]] constexpr fixed_t<Precision> divide(fixed_t<Precision> value) const
+    {
+        return fixed_t<Precision>::from_data(divide(value.data()));
+    }
+
+    /**
+     * @brief Returns the division of the given value by the divisor of the given fast_divider.
+     */
+    [[nodiscard]] constexpr friend int operator/(int value, const fast_divider& divider)
+    {
+        return divider.divide(value);
+    }
+
+    /**
+     * @brief Returns the division of the given fixed point value by the divisor of the given fast_divider.
+     */
+    template<int Precision>
+    [[nodiscard]] constexpr friend fixed_t<Precision> operator/(fixed_t<Precision> value,
+                                                                const fast_divider& divider)
+    {
+        return divider.divide(value);
+    }
+
+    /**
+     * @brief Default equal operator.
+     */
+    [[nodiscard]] constexpr friend bool operator==(const fast_divider& a, const fast_divider& b) = default;
+
+private:
+    int _divisor;
+    unsigned _magic = 0;
+    uint8_t _shift = 0;
+    bool _add = false;
+
+    [[nodiscard]] static constexpr unsigned _abs(int value)
+    {
+        return value < 0 ? 0U - unsigned(value) : unsigned(value);
+    }
+};
+
+}
+
+#endif
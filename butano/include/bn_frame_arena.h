@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_FRAME_ARENA_H
+#define BN_FRAME_ARENA_H
+
+/**
+ * @file
+ * bn::frame_arena header file.
+ *
+ * @ingroup memory
+ */
+
+#include <new>
+#include "bn_span.h"
+#include "bn_utility.h"
+#include "bn_type_traits.h"
+#include "bn_config_frame_arena.h"
+
+/**
+ * @brief Per-frame linear memory arenas.
+ *
+ * Allocations are just a pointer increment and they can't be deallocated one by one:
+ * all of them are released at once when bn::core::update is called.
+ *
+ * Memory returned by them must not be used after calling bn::core::update.
+ *
+ * They are disabled by default: their sizes must be specified with @ref BN_CFG_FRAME_ARENA_IWRAM_BYTES
+ * and @ref BN_CFG_FRAME_ARENA_EWRAM_BYTES before using them.
+ *
+ * @ingroup memory
+ */
+namespace bn::frame_arena
+{
+    /**
+     * @brief Allocates uninitialized storage in the IWRAM frame arena.
+     * @param bytes Bytes to allocate.
+     * @param alignment Alignment in bytes of the returned pointer (it must be a power of two).
+     * @return Pointer to the beginning of newly allocated memory.
+     *
+     * If there's not enough free space, an assert is triggered.
+     */
+    [[nodiscard]] void* iwram_alloc(int bytes, int alignment = 4);
+
+    /**
+     * @brief Allocates uninitialized storage in the EWRAM frame arena.
+     * @param bytes Bytes to allocate.
+     * @param alignment Alignment in bytes of the returned pointer (it must be a power of two).
+     * @return Pointer to the beginning of newly allocated memory.
+     *
+     * If there's not enough free space, an assert is triggered.
+     */
+    [[nodiscard]] void* ewram_alloc(int bytes, int alignment = 4);
+
+    /**
+     * @brief Allocates and default constructs the given number of elements in the IWRAM frame arena.
+     * @param size Number of elements to allocate.
+     * @return span referencing the new elements.
+     *
+     * If there's not enough free space, an assert is triggered.
+     */
+    template<typename Type>
+    [[nodiscard]] span<Type> iwram_span(int size)
+    {
+        static_assert(is_trivially_destructible_v<Type>, "Type is not trivially destructible");
+
+        auto result = static_cast<Type*>(iwram_alloc(int(sizeof(Type)) * size, alignof(Type)));
+
+        for(int index = 0; index < size; ++index)
+        {
+            ::new(result + index) Type();
+        }
+
+        return span<Type>(result, size);
+    }
+
+    /**
+     * @brief Allocates and default constructs the given number of elements in the EWRAM frame arena.
+     * @param size Number of elements to allocate.
+     * @return span referencing the new elements.
+     *
+     * If there's not enough free space, an assert is triggered.
+     */
+    template<typename Type>
+    [[nodiscard]] span<Type> ewram_span(int size)
+    {
+        static_assert(is_trivially_destructible_v<Type>, "Type is not trivially destructible");
+
+        auto result = static_cast<Type*>(ewram_alloc(int(sizeof(Type)) * size, alignof(Type)));
+
+        for(int index = 0; index < size; ++index)
+        {
+            ::new(result + index) Type();
+        }
+
+        return span<Type>(result, size);
+    }
+
+    /**
+     * @brief Returns the number of bytes allocated in the IWRAM frame arena since the last reset.
+     */
+    [[nodiscard]] int used_iwram();
+
+    /**
+     * @brief Returns the number of bytes that still can be allocated in the IWRAM frame arena.
+     */
+    [[nodiscard]] int available_iwram();
+
+    /**
+     * @brief Returns the maximum number of bytes allocated in the IWRAM frame arena in a single frame
+     * (high-water mark).
+     */
+    [[nodiscard]] int max_used_iwram();
+
+    /**
+     * @brief Returns the number of bytes allocated in the EWRAM frame arena since the last reset.
+     */
+    [[nodiscard]] int used_ewram();
+
+    /**
+     * @brief Returns the number of bytes that still can be allocated in the EWRAM frame arena.
+     */
+    [[nodiscard]] int available_ewram();
+
+    /**
+     * @brief Returns the maximum number of bytes allocated in the EWRAM frame arena in a single frame
+     * (high-water mark).
+     */
+    [[nodiscard]] int max_used_ewram();
+
+    /**
+     * @brief Releases all allocations of both frame arenas.
+     *
+     * It is called automatically by bn::core::update.
+     */
+    void reset();
+
+    /**
+     * @brief Forgets the maximum number of bytes allocated in both frame arenas.
+     */
+    void reset_max_used();
+
+    /**
+     * @brief Logs the current status of both frame arenas.
+     */
+    void log_status();
+}
+
+#endif
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_IWRAM_OVERLAY_H
+#define BN_IWRAM_OVERLAY_H
+
+/**
+ * @file
+ * bn::iwram_overlay header file.
+ *
+ * @ingroup memory
+ */
+
+#include "bn_optional_fwd.h"
+
+/**
+ * @brief IWRAM overlays related functions.
+ *
+ * IWRAM overlays allow to share the same IWRAM region between multiple sets of code and data,
+ * for example one set for each scene of a game.
+ *
+ * Code and data can be stored in an IWRAM overlay with the `BN_CODE_IWRAM_OVERLAY` and
+ * `BN_DATA_IWRAM_OVERLAY` macros. Source files with `.bn_iwram_overlay.cpp` extension are built in ARM mode
+ * like `.bn_iwram.cpp` ones, but they are not stored in IWRAM automatically.
+ *
+ * Only one IWRAM overlay can be loaded at the same time,
+ * and references between different overlays are not allowed.
+ *
+ * IWRAM overlays are not supported by all toolchains.
+ *
+ * @ingroup memory
+ */
+namespace bn::iwram_overlay
+{
+    /**
+     * @brief Indicates if IWRAM overlays are supported by the current toolchain or not.
+     */
+    [[nodiscard]] bool supported();
+
+    /**
+     * @brief Returns the number of available IWRAM overlays.
+     */
+    [[nodiscard]] int count();
+
+    /**
+     * @brief Returns the size in bytes of the IWRAM overlay with the given id.
+     */
+    [[nodiscard]] int bytes(int id);
+
+    /**
+     * @brief Returns the size in bytes of the IWRAM region shared by all overlays
+     * (the size of the biggest overlay).
+     */
+    [[nodiscard]] int max_bytes();
+
+    /**
+     * @brief Returns the id of the currently loaded IWRAM overlay, if any.
+     */
+    [[nodiscard]] const optional<int>& loaded_id();
+
+    /**
+     * @brief Indicates if the IWRAM overlay with the given id is loaded or not.
+     */
+    [[nodiscard]] bool loaded(int id);
+
+    /**
+     * @brief Copies the code and data of the IWRAM overlay with the given id from ROM to IWRAM,
+     * replacing the previously loaded one.
+     *
+     * If the specified IWRAM overlay is already loaded, this function does nothing.
+     *
+     * Data stored in the overlay is reset to its initial value each time it is loaded.
+     */
+    void load(int id);
+
+    /**
+     * @brief Forgets the currently loaded IWRAM overlay, so the next call to load always copies it.
+     */
+    void unload();
+
+    /**
+     * @brief Returns the number of timer ticks spent by the last effective call to load.
+     *
+     * One timer tick is equivalent to 64 CPU clock cycles.
+     */
+    [[nodiscard]] int last_load_ticks();
+}
+
+#endif
@@ -23,6 +23,8 @@ namespace bn
 /**
  * @brief Link communication related functions.
  *
+ * Link communication uses the hardware timer 1, so it can't be used while bn::sampling_profiler is running.
+ *
  * @ingroup link
  */
 namespace bn::link
@@ -484,6 +484,65 @@ namespace bn
             return reciprocal_lut._data[lut_value];
         }
     }
+
+    /**
+     * @brief Returns an approximation of the division of the given fixed point values
+     * without calling integer division routines.
+     *
+     * The reciprocal of the divisor is approximated with reciprocal_seed_lut and refined with one
+     * Newton-Raphson step. A final remainder check makes results with an absolute value lower than 2^18
+     * (in fixed point units) exact, and the relative error of bigger results is lower than 2^-18.
+     *
+     * @param dividend Fixed point dividend.
+     * @param divisor Fixed point divisor (it can't be zero).
+     * @return Approximation of dividend / divisor, with the same overflow behavior as
+     * fixed_t::safe_division (the result must fit in a fixed_t).
+     *
+     * @ingroup math
+     */
+    template<int Precision>
+    [[nodiscard]] constexpr fixed_t<Precision> fast_division(fixed_t<Precision> dividend,
+                                                             fixed_t<Precision> divisor)
+    {
+        static_assert(Precision <= 31);
+
+        int dividend_data = dividend.data();
+        int divisor_data = divisor.data();
+        BN_ASSERT(divisor_data, "Divisor is zero");
+
+        auto abs_dividend = unsigned(dividend_data < 0 ? -int64_t(dividend_data) : dividend_data);
+        auto abs_divisor = unsigned(divisor_data < 0 ? -int64_t(divisor_data) : divisor_data);
+
+        // Normalize the divisor to the range [2^31, 2^32):
+        int shift = __builtin_clz(abs_divisor);
+        unsigned normalized_divisor = abs_divisor << shift;
+        int lut_index = int(normalized_divisor >> 22) & (reciprocal_seed_lut_size - 1);
+        unsigned seed;
+
+        if(is_constant_evaluated())
+        {
+            seed = calculate_reciprocal_seed_lut_value(lut_index);
+        }
+        else
+        {
+            seed = reciprocal_seed_lut._data[lut_index];
+        }
+
+        // One Newton-Raphson step (reciprocal = reciprocal * (2 - normalized_divisor * reciprocal)):
+        auto reciprocal = int64_t(seed << 16);
+        auto error = int(int64_t((uint64_t(1) << 63) - (uint64_t(normalized_divisor) * uint64_t(reciprocal))) >> 31);
+        reciprocal += (reciprocal * error) >> 32;
+
+        auto abs_result = unsigned((uint64_t(abs_dividend) * uint64_t(reciprocal)) >> (63 - Precision - shift));
+
+        // The approximated reciprocal is never greater than the real one, so the result can only be too small:
+        if((uint64_t(abs_dividend) << Precision) - (uint64_t(abs_result) * abs_divisor) >= abs_divisor)
+        {
+            ++abs_result;
+        }
+
+        return fixed_t<Precision>::from_data((dividend_data ^ divisor_data) < 0 ? -int(abs_result) : int(abs_result));
+    }
 }
 
 #endif
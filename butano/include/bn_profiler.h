@@ -54,8 +54,18 @@
     {
         /**
          * @brief Stops the execution and shows the profiling results on the screen.
+         *
+         * Profiling results are also logged with bn::profiler::log before stopping the execution.
          */
         [[noreturn]] void show();
+
+        /**
+         * @brief Logs the profiling results without stopping the execution.
+         *
+         * Each entry is logged in a separate line with the following format:
+         * `profiler: <id> <total ticks> <max ticks>`.
+         */
+        void log();
     }
 
     /// @cond DO_NOT_DOCUMENT
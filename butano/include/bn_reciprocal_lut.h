@@ -8,7 +8,7 @@
 
 /**
  * @file
- * bn::reciprocal_lut and bn::reciprocal_16_lut header file.
+ * bn::reciprocal_lut, bn::reciprocal_16_lut and bn::reciprocal_seed_lut header file.
  *
  * @ingroup math
  */
@@ -64,6 +64,36 @@ constexpr int reciprocal_16_lut_size = 1025;
  */
 alignas(int) extern const array<uint16_t, reciprocal_16_lut_size>& reciprocal_16_lut;
 
+/**
+ * @brief Reciprocal seed LUT size.
+ *
+ * @ingroup math
+ */
+constexpr int reciprocal_seed_lut_size = 512;
+
+/**
+ * @brief Calculates the value to store in the reciprocal seed LUT for the given index.
+ * @param lut_value Index in the range [0, reciprocal_seed_lut_size - 1].
+ * @return Upper 16 bits of (2^63 / divisor), where divisor is the center of the range of normalized divisors
+ * ([2^31, 2^32)) whose 9 bits after the leading one are equal to the given index.
+ *
+ * @ingroup math
+ */
+[[nodiscard]] constexpr uint16_t calculate_reciprocal_seed_lut_value(int lut_value)
+{
+    BN_ASSERT(lut_value >= 0 && lut_value < reciprocal_seed_lut_size, "Invalid lut value: ", lut_value);
+
+    uint64_t divisor = (uint64_t(reciprocal_seed_lut_size + lut_value) << 22) + (uint64_t(1) << 21);
+    return uint16_t(((uint64_t(1) << 63) / divisor) >> 16);
+}
+
+/**
+ * @brief Reciprocal seed LUT, used by bn::fast_division as the initial approximation of Newton-Raphson.
+ *
+ * @ingroup math
+ */
+alignas(int) extern const array<uint16_t, reciprocal_seed_lut_size>& reciprocal_seed_lut;
+
 }
 
 #endif
@@ -14,6 +14,7 @@
  * @ingroup action
  */
 
+#include "bn_tween_system.h"
 #include "bn_regular_bg_ptr.h"
 #include "bn_value_template_actions.h"
 
@@ -449,6 +450,19 @@ public:
 };
 
 
+/**
+ * @brief Modifies the position of multiple regular_bg_ptr objects until they have given states,
+ * following easing curves.
+ *
+ * @tparam MaxSize Maximum number of tweens.
+ *
+ * @ingroup regular_bg
+ * @ingroup action
+ */
+template<int MaxSize>
+using regular_bg_move_tween_system = tween_system<regular_bg_ptr, fixed_point, regular_bg_position_manager, MaxSize>;
+
+
 // mosaic
 
 /**
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_SAMPLING_PROFILER_H
+#define BN_SAMPLING_PROFILER_H
+
+/**
+ * @file
+ * bn::sampling_profiler header file.
+ *
+ * @ingroup profiler
+ */
+
+#include "bn_config_doxygen.h"
+#include "bn_config_profiler.h"
+
+#if BN_CFG_SAMPLING_PROFILER_ENABLED || BN_DOXYGEN
+    /**
+     * @brief Statistical profiler related functions.
+     *
+     * It interrupts the CPU periodically with the hardware timer 1 and records the address of the interrupted code,
+     * so hot spots can be found without instrumenting the code with BN_PROFILER_START and BN_PROFILER_STOP.
+     *
+     * There's no free hardware timer for it: timer 0 is used by Direct Sound audio and timers 2 and 3 by the engine,
+     * so timer 1 is shared with link communication. Link communication can't be used while the sampling profiler
+     * is running, and the sampling profiler can't be started while link communication is active.
+     *
+     * Recorded addresses can be logged with bn::sampling_profiler::log and symbolized with
+     * `butano/tools/butano_sampling_profiler_tool.py` and the ELF file of the ROM.
+     *
+     * It can be enabled or disabled by overloading the definition of @ref BN_CFG_SAMPLING_PROFILER_ENABLED.
+     *
+     * @ingroup profiler
+     */
+    namespace bn::sampling_profiler
+    {
+        /**
+         * @brief Starts recording samples.
+         * @param samples_per_second Number of samples to record per second, in the range [4..16384].
+         *
+         * To avoid aliasing with the frame rate, a prime number like 1009 is recommended.
+         *
+         * It fails if link communication is active, since both use the hardware timer 1.
+         * Call bn::link::deactivate before starting it.
+         */
+        void start(int samples_per_second);
+
+        /**
+         * @brief Stops recording samples. Recorded samples are kept.
+         */
+        void stop();
+
+        /**
+         * @brief Indicates if the sampling profiler is recording samples or not.
+         */
+        [[nodiscard]] bool running();
+
+        /**
+         * @brief Returns the number of recorded samples.
+         */
+        [[nodiscard]] int samples_count();
+
+        /**
+         * @brief Returns the number of samples which couldn't be recorded because the histogram was too crowded.
+         *
+         * If it is not zero, @ref BN_CFG_SAMPLING_PROFILER_MAX_ADDRESSES should be increased.
+         */
+        [[nodiscard]] int lost_samples_count();
+
+        /**
+         * @brief Forgets all recorded samples.
+         */
+        void reset();
+
+        /**
+         * @brief Logs the recorded samples.
+         *
+         * Each recorded address is logged in a separate line with the following format:
+         * `sampling_profiler: <address> <samples count>`.
+         */
+        void log();
+    }
+#endif
+
+#endif
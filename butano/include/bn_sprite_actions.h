@@ -15,6 +15,7 @@
  */
 
 #include "bn_sprite_ptr.h"
+#include "bn_tween_system.h"
 #include "bn_value_template_actions.h"
 
 namespace bn
@@ -436,6 +437,18 @@ public:
 };
 
 
+/**
+ * @brief Modifies the position of multiple sprite_ptr objects until they have given states, following easing curves.
+ *
+ * @tparam MaxSize Maximum number of tweens.
+ *
+ * @ingroup sprite
+ * @ingroup action
+ */
+template<int MaxSize>
+using sprite_move_tween_system = tween_system<sprite_ptr, fixed_point, sprite_position_manager, MaxSize>;
+
+
 // rotation
 
 /**
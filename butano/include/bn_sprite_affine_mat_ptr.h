@@ -63,6 +63,37 @@ public:
      */
     [[nodiscard]] static optional<sprite_affine_mat_ptr> create_optional(const affine_mat_attributes& attributes);
 
+    /**
+     * @brief Searches for a shared affine transformation matrix with the specified attributes.
+     * If it is not found, it creates a new shared affine transformation matrix.
+     *
+     * The rotation angle and the scales of the given attributes are rounded with the steps specified by
+     * BN_CFG_SPRITE_AFFINE_MATS_SHARED_ROTATION_ANGLE_STEP and BN_CFG_SPRITE_AFFINE_MATS_SHARED_SCALE_STEP,
+     * so sprites with similar transformations can share the same matrix.
+     *
+     * Modifying the attributes of a shared matrix with a sprite_affine_mat_ptr stops sharing it.
+     *
+     * @param attributes affine_mat_attributes of the output matrix.
+     * @return The requested sprite_affine_mat_ptr.
+     */
+    [[nodiscard]] static sprite_affine_mat_ptr create_shared(const affine_mat_attributes& attributes);
+
+    /**
+     * @brief Searches for a shared affine transformation matrix with the specified attributes.
+     * If it is not found, it creates a new shared affine transformation matrix.
+     *
+     * The rotation angle and the scales of the given attributes are rounded with the steps specified by
+     * BN_CFG_SPRITE_AFFINE_MATS_SHARED_ROTATION_ANGLE_STEP and BN_CFG_SPRITE_AFFINE_MATS_SHARED_SCALE_STEP,
+     * so sprites with similar transformations can share the same matrix.
+     *
+     * Modifying the attributes of a shared matrix with a sprite_affine_mat_ptr stops sharing it.
+     *
+     * @param attributes affine_mat_attributes of the output matrix.
+     * @return The requested sprite_affine_mat_ptr if it could be found or allocated; bn::nullopt otherwise.
+     */
+    [[nodiscard]] static optional<sprite_affine_mat_ptr> create_shared_optional(
+            const affine_mat_attributes& attributes);
+
     /**
      * @brief Copy constructor.
      * @param other sprite_affine_mat_ptr to copy.
@@ -111,6 +142,14 @@ public:
         return _id;
     }
 
+    /**
+     * @brief Indicates if this matrix can be returned by create_shared and create_shared_optional.
+     *
+     * The transformation setters of sprite_ptr don't modify shared matrices:
+     * they replace them with another shared matrix instead.
+     */
+    [[nodiscard]] bool shared() const;
+
     /**
      * @brief Returns the rotation angle in degrees.
      */
@@ -35,6 +35,30 @@ namespace bn::sprite_affine_mats
      * that can be managed with sprite_affine_mat_ptr objects.
      */
     [[nodiscard]] int available_count();
+
+    /**
+     * @brief Returns the number of unique shared sprite affine transformation matrices
+     * created with sprite_affine_mat_ptr::create_shared and sprite_affine_mat_ptr::create_shared_optional.
+     */
+    [[nodiscard]] int shared_count();
+
+    /**
+     * @brief Indicates if the sprite affine transformation matrices created by the transformation setters
+     * of sprite_ptr (sprite_ptr::set_rotation_angle, sprite_ptr::set_scale, etc) are shared or not.
+     *
+     * Sprites with shared matrices share the same hardware matrix when their quantized transformations
+     * are the same, so more than 32 sprites can be rotated and scaled at the same time.
+     */
+    [[nodiscard]] bool shared_by_default();
+
+    /**
+     * @brief Sets if the sprite affine transformation matrices created by the transformation setters
+     * of sprite_ptr (sprite_ptr::set_rotation_angle, sprite_ptr::set_scale, etc) are shared or not.
+     *
+     * Sprites with shared matrices share the same hardware matrix when their quantized transformations
+     * are the same, so more than 32 sprites can be rotated and scaled at the same time.
+     */
+    void set_shared_by_default(bool shared_by_default);
 }
 
 #endif
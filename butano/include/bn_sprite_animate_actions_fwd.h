@@ -57,6 +57,30 @@ namespace bn
      */
     template<int MaxSize>
     class sprite_cached_animate_action;
+
+
+    // streamed animation
+
+    class isprite_streamed_animate_action;
+
+    /**
+     * @brief Changes the tile set of a sprite_ptr when the action is updated a given number of times.
+     *
+     * This action differs from sprite_animate_action in that it reserves two sprite tile sets in VRAM
+     * (the one being displayed and a back one): when the tile set must be changed, the next one is copied
+     * to the back VRAM slot outside of VBlank and then it is displayed with a single attributes change,
+     * so the VBlank time doesn't increase when the tile set changes.
+     *
+     * Compressed tiles are not supported.
+     *
+     * @tparam MaxSize Maximum number of indexes to sprite tile sets to store.
+     *
+     * @ingroup sprite
+     * @ingroup tile
+     * @ingroup action
+     */
+    template<int MaxSize>
+    class sprite_streamed_animate_action;
 }
 
 #endif
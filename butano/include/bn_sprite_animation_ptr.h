@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_SPRITE_ANIMATION_PTR_H
+#define BN_SPRITE_ANIMATION_PTR_H
+
+/**
+ * @file
+ * bn::sprite_animation_ptr header file.
+ *
+ * @ingroup sprite
+ * @ingroup action
+ */
+
+#include "bn_span.h"
+#include "bn_functional.h"
+
+namespace bn
+{
+
+class sprite_ptr;
+class sprite_tiles_item;
+
+/**
+ * @brief std::shared_ptr like smart pointer that retains shared ownership of a sprite animation.
+ *
+ * Unlike sprite_animate_action objects, sprite animations don't need to be updated manually:
+ * all of them are updated by the engine in core::update, in a single pass over tightly packed arrays.
+ *
+ * The sprite tile sets of each frame are created when the animation is created,
+ * so changing frames never uploads tiles to VRAM.
+ *
+ * Several sprite_animation_ptr objects may own the same sprite animation.
+ *
+ * The sprite animation is released when the last remaining sprite_animation_ptr owning it is destroyed.
+ *
+ * @ingroup sprite
+ * @ingroup action
+ */
+class sprite_animation_ptr
+{
+
+public:
+    /**
+     * @brief Creates a sprite_animation_ptr which loops over the given sprite tile sets only once.
+     * @param sprite sprite_ptr to copy.
+     * @param wait_updates Number of times the animation must be updated before changing the tiles
+     * of the given sprite_ptr.
+     * @param tiles_item It creates the new sprite tiles to use by the given sprite_ptr.
+     * @param graphics_indexes Indexes of the tile sets to reference in tiles_item.
+     * @return The requested sprite_animation_ptr.
+     */
+    [[nodiscard]] static sprite_animation_ptr once(
+            const sprite_ptr& sprite, int wait_updates, const sprite_tiles_item& tiles_item,
+            const span<const uint16_t>& graphics_indexes);
+
+    /**
+     * @brief Creates a sprite_animation_ptr which loops over the given sprite tile sets only once.
+     * @param sprite sprite_ptr to move.
+     * @param wait_updates Number of times the animation must be updated before changing the tiles
+     * of the given sprite_ptr.
+     * @param tiles_item It creates the new sprite tiles to use by the given sprite_ptr.
+     * @param graphics_indexes Indexes of the tile sets to reference in tiles_item.
+     * @return The requested sprite_animation_ptr.
+     */
+    [[nodiscard]] static sprite_animation_ptr once(
+            sprite_ptr&& sprite, int wait_updates, const sprite_tiles_item& tiles_item,
+            const span<const uint16_t>& graphics_indexes);
+
+    /**
+     * @brief Creates a sprite_animation_ptr which loops over the given sprite tile sets forever.
+     * @param sprite sprite_ptr to copy.
+     * @param wait_updates Number of times the animation must be updated before changing the tiles
+     * of the given sprite_ptr.
+     * @param tiles_item It creates the new sprite tiles to use by the given sprite_ptr.
+     * @param graphics_indexes Indexes of the tile sets to reference in tiles_item.
+     * @return The requested sprite_animation_ptr.
+     */
+    [[nodiscard]] static sprite_animation_ptr forever(
+            const sprite_ptr& sprite, int wait_updates, const sprite_tiles_item& tiles_item,
+            const span<const uint16_t>& graphics_indexes);
+
+    /**
+     * @brief Creates a sprite_animation_ptr which loops over the given sprite tile sets forever.
+     * @param sprite sprite_ptr to move.
+     * @param wait_updates Number of times the animation must be updated before changing the tiles
+     * of the given sprite_ptr.
+     * @param tiles_item It creates the new sprite tiles to use by the given sprite_ptr.
+     * @param graphics_indexes Indexes of the tile sets to reference in tiles_item.
+     * @return The requested sprite_animation_ptr.
+     */
+    [[nodiscard]] static sprite_animation_ptr forever(
+            sprite_ptr&& sprite, int wait_updates, const sprite_tiles_item& tiles_item,
+            const span<const uint16_t>& graphics_indexes);
+
+    /**
+     * @brief Copy constructor.
+     * @param other sprite_animation_ptr to copy.
+     */
+    sprite_animation_ptr(const sprite_animation_ptr& other);
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other sprite_animation_ptr to copy.
+     * @return Reference to this.
+     */
+    sprite_animation_ptr& operator=(const sprite_animation_ptr& other);
+
+    /**
+     * @brief Move constructor.
+     * @param other sprite_animation_ptr to move.
+     */
+    sprite_animation_ptr(sprite_animation_ptr&& other) noexcept :
+        sprite_animation_ptr(other._id)
+    {
+        other._id = -1;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other sprite_animation_ptr to move.
+     * @return Reference to this.
+     */
+    sprite_animation_ptr& operator=(sprite_animation_ptr&& other) noexcept
+    {
+        bn::swap(_id, other._id);
+        return *this;
+    }
+
+    /**
+     * @brief Releases the referenced sprite animation if no more sprite_animation_ptr objects reference to it.
+     */
+    ~sprite_animation_ptr();
+
+    /**
+     * @brief Returns the internal id.
+     */
+    [[nodiscard]] int id() const
+    {
+        return _id;
+    }
+
+    /**
+     * @brief Returns the animated sprite_ptr.
+     */
+    [[nodiscard]] const sprite_ptr& sprite() const;
+
+    /**
+     * @brief Returns the number of times the animation must be updated before changing the tiles
+     * of the animated sprite_ptr.
+     */
+    [[nodiscard]] int wait_updates() const;
+
+    /**
+     * @brief Sets the number of times the animation must be updated before changing the tiles
+     * of the animated sprite_ptr.
+     */
+    void set_wait_updates(int wait_updates);
+
+    /**
+     * @brief Indicates if the animation loops over the sprite tile sets forever or not.
+     */
+    [[nodiscard]] bool update_forever() const;
+
+    /**
+     * @brief Returns the number of sprite tile sets of the animation.
+     */
+    [[nodiscard]] int frames_count() const;
+
+    /**
+     * @brief Returns the index of the next sprite tile set to use.
+     */
+    [[nodiscard]] int current_index() const;
+
+    /**
+     * @brief Indicates if the animation has finished or not.
+     *
+     * Animations created with forever() are never done.
+     */
+    [[nodiscard]] bool done() const;
+
+    /**
+     * @brief Resets the animation to its initial state.
+     */
+    void reset();
+
+    /**
+     * @brief Exchanges the contents of this sprite_animation_ptr with those of the other one.
+     * @param other sprite_animation_ptr to exchange the contents with.
+     */
+    void swap(sprite_animation_ptr& other)
+    {
+        bn::swap(_id, other._id);
+    }
+
+    /**
+     * @brief Exchanges the contents of a sprite_animation_ptr with those of another one.
+     * @param a First sprite_animation_ptr to exchange the contents with.
+     * @param b Second sprite_animation_ptr to exchange the contents with.
+     */
+    friend void swap(sprite_animation_ptr& a, sprite_animation_ptr& b)
+    {
+        bn::swap(a._id, b._id);
+    }
+
+    /**
+     * @brief Default equal operator.
+     */
+    [[nodiscard]] friend bool operator==(const sprite_animation_ptr& a, const sprite_animation_ptr& b) = default;
+
+private:
+    int16_t _id;
+
+    explicit sprite_animation_ptr(int id) :
+        _id(int16_t(id))
+    {
+    }
+};
+
+
+/**
+ * @brief Hash support for sprite_animation_ptr.
+ *
+ * @ingroup sprite
+ * @ingroup action
+ * @ingroup functional
+ */
+template<>
+struct hash<sprite_animation_ptr>
+{
+    /**
+     * @brief Returns the hash of the given sprite_animation_ptr.
+     */
+    [[nodiscard]] unsigned operator()(const sprite_animation_ptr& value) const
+    {
+        return make_hash(value.id());
+    }
+};
+
+}
+
+#endif
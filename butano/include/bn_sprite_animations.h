@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_SPRITE_ANIMATIONS_H
+#define BN_SPRITE_ANIMATIONS_H
+
+/**
+ * @file
+ * bn::sprite_animations header file.
+ *
+ * @ingroup sprite
+ * @ingroup action
+ */
+
+#include "bn_common.h"
+
+/**
+ * @brief Sprite animations related functions.
+ *
+ * @ingroup sprite
+ * @ingroup action
+ */
+namespace bn::sprite_animations
+{
+    /**
+     * @brief Returns the number of used sprite animations managed with sprite_animation_ptr objects.
+     */
+    [[nodiscard]] int used_items_count();
+
+    /**
+     * @brief Returns the number of available sprite animations
+     * that can be managed with sprite_animation_ptr objects.
+     */
+    [[nodiscard]] int available_items_count();
+}
+
+#endif
@@ -16,6 +16,7 @@
  */
 
 #include "bn_fixed.h"
+#include "bn_tween_system.h"
 #include "bn_sprite_palette_ptr.h"
 #include "bn_value_template_actions.h"
 
@@ -758,6 +759,20 @@ public:
 };
 
 
+/**
+ * @brief Modifies the intensity of the fade effect applied to multiple sprite_palette_ptr objects
+ * until they have given states, following easing curves.
+ *
+ * @tparam MaxSize Maximum number of tweens.
+ *
+ * @ingroup sprite
+ * @ingroup palette
+ * @ingroup action
+ */
+template<int MaxSize>
+using sprite_palette_fade_tween_system = tween_system<sprite_palette_ptr, fixed, sprite_palette_fade_manager, MaxSize>;
+
+
 // rotate
 
 /**
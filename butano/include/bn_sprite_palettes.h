@@ -39,6 +39,17 @@ namespace bn::sprite_palettes
      */
     [[nodiscard]] int available_colors_count();
 
+    /**
+     * @brief Returns the number of times an existing 4BPP sprite color palette has been reused
+     * instead of creating a new one with the same colors.
+     */
+    [[nodiscard]] int reused_palettes_count();
+
+    /**
+     * @brief Returns the number of 4BPP sprite color palettes that have been created.
+     */
+    [[nodiscard]] int created_palettes_count();
+
     /**
      * @brief Returns the brightness of all sprite color palettes.
      */
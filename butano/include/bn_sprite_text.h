@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_SPRITE_TEXT_H
+#define BN_SPRITE_TEXT_H
+
+/**
+ * @file
+ * bn::sprite_text header file.
+ *
+ * @ingroup sprite
+ * @ingroup text
+ */
+
+#include "bn_sprite_ptr.h"
+#include "bn_sprite_palette_ptr.h"
+#include "bn_sprite_text_generator.h"
+
+namespace bn
+{
+
+/**
+ * @brief Single line of text printed with sprites that are kept alive between text updates.
+ *
+ * Instead of generating new sprites each time the text changes (as sprite_text_generator::generate does),
+ * it only redraws the 8 pixels wide tile columns whose characters have changed.
+ *
+ * It supports the same sprite fonts that sprite_text_generator can print with multiple characters per sprite.
+ *
+ * @ingroup sprite
+ * @ingroup text
+ */
+class sprite_text
+{
+
+public:
+    static constexpr int max_sprites = 16; //!< Maximum number of sprites that can be used to print the text.
+
+    /**
+     * @brief Constructor.
+     * @param generator sprite_text_generator that specifies the font, palette, alignment and priorities
+     * of the output sprites.
+     * @param position Position of the text, considering the alignment of the given generator.
+     */
+    sprite_text(const sprite_text_generator& generator, const fixed_point& position);
+
+    /**
+     * @brief Constructor.
+     * @param generator sprite_text_generator that specifies the font, palette, alignment and priorities
+     * of the output sprites.
+     * @param position Position of the text, considering the alignment of the given generator.
+     * @param text Single line of text to print.
+     */
+    sprite_text(const sprite_text_generator& generator, const fixed_point& position, const string_view& text);
+
+    sprite_text(const sprite_text& other) = delete;
+
+    sprite_text& operator=(const sprite_text& other) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other sprite_text to move.
+     */
+    sprite_text(sprite_text&& other) = default;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other sprite_text to move.
+     * @return Reference to this.
+     */
+    sprite_text& operator=(sprite_text&& other) = default;
+
+    /**
+     * @brief Returns the sprite_text_generator that specifies the font, palette, alignment and priorities
+     * of the output sprites.
+     */
+    [[nodiscard]] const sprite_text_generator& generator() const
+    {
+        return _generator;
+    }
+
+    /**
+     * @brief Returns the position of the text, considering the alignment of the generator.
+     */
+    [[nodiscard]] const fixed_point& position() const
+    {
+        return _position;
+    }
+
+    /**
+     * @brief Sets the position of the text, considering the alignment of the generator.
+     */
+    void set_position(const fixed_point& position);
+
+    /**
+     * @brief Returns the width in pixels of the current text.
+     */
+    [[nodiscard]] int width() const
+    {
+        return _width;
+    }
+
+    /**
+     * @brief Indicates if the text must be committed to the GBA or not.
+     */
+    [[nodiscard]] bool visible() const
+    {
+        return _visible;
+    }
+
+    /**
+     * @brief Sets if the text must be committed to the GBA or not.
+     */
+    void set_visible(bool visible);
+
+    /**
+     * @brief Prints the given single line of text, redrawing only the tile columns that have changed.
+     */
+    void set_text(const string_view& text);
+
+    /**
+     * @brief Returns the sprites used to print the text (some of them can be hidden).
+     */
+    [[nodiscard]] const ivector<sprite_ptr>& sprites() const
+    {
+        return _sprites;
+    }
+
+    /**
+     * @brief Returns the number of sprites used to print the current text.
+     */
+    [[nodiscard]] int used_sprites_count() const
+    {
+        return _used_sprites_count;
+    }
+
+    /**
+     * @brief Returns the number of sprite tiles written in VRAM by the last set_text call.
+     */
+    [[nodiscard]] int last_updated_tiles_count() const
+    {
+        return _last_updated_tiles_count;
+    }
+
+    /**
+     * @brief Returns the number of sprite tiles written in VRAM since this sprite_text was created.
+     */
+    [[nodiscard]] int total_updated_tiles_count() const
+    {
+        return _total_updated_tiles_count;
+    }
+
+private:
+    static constexpr int _columns_per_sprite = 4;
+    static constexpr int _max_columns = max_sprites * _columns_per_sprite;
+    static constexpr int _max_glyphs = max_sprites * 8;
+
+    sprite_text_generator _generator;
+    sprite_palette_ptr _palette;
+    vector<sprite_ptr, max_sprites> _sprites;
+    fixed_point _position;
+    uint32_t _glyph_keys[_max_glyphs] = {};
+    uint8_t _column_first_glyphs[_max_columns] = {};
+    uint8_t _column_glyphs_counts[_max_columns] = {};
+    tile* _sprites_tiles_vram[max_sprites] = {};
+    int16_t _sprite_x_offsets[max_sprites] = {};
+    int _width = 0;
+    int _used_sprites_count = 0;
+    int _last_updated_tiles_count = 0;
+    int _total_updated_tiles_count = 0;
+    int8_t _character_width;
+    int8_t _character_height;
+    bool _fixed_width;
+    bool _visible = true;
+
+    void _add_sprite();
+
+    void _update_sprites();
+};
+
+}
+
+#endif
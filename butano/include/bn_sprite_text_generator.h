@@ -23,6 +23,7 @@ namespace bn
 {
 
 class sprite_ptr;
+class text_layout;
 
 /**
  * @brief Generates sprites containing text from a given sprite_font.
@@ -241,6 +242,35 @@ public:
      */
     void generate(const fixed_point& position, const string_view& text, ivector<sprite_ptr>& output_sprites) const;
 
+    /**
+     * @brief Generates text sprites for the given multi-line text layout.
+     * @param position Position of the first line of the layout box, with its horizontal coordinate at the left
+     * side of the box (the current alignment is ignored, the alignment of the layout is used instead).
+     * @param layout Multi-line text layout calculated with the same sprite_font as this generator.
+     * @param output_sprites Generated text sprites are stored in this vector.
+     *
+     * Line widths are not calculated again, and each line is placed below the previous one.
+     *
+     * Keep in mind that this vector is not cleared before generating text.
+     */
+    void generate(const fixed_point& position, const text_layout& layout, ivector<sprite_ptr>& output_sprites) const;
+
+    /**
+     * @brief Generates text sprites for the first characters of the given multi-line text layout.
+     * @param position Position of the first line of the layout box, with its horizontal coordinate at the left
+     * side of the box (the current alignment is ignored, the alignment of the layout is used instead).
+     * @param layout Multi-line text layout calculated with the same sprite_font as this generator.
+     * @param characters_count Number of characters of the layout to print (line breaks included),
+     * useful to reveal a text character by character.
+     * @param output_sprites Generated text sprites are stored in this vector.
+     *
+     * Line widths are not calculated again, and each line is placed below the previous one.
+     *
+     * Keep in mind that this vector is not cleared before generating text.
+     */
+    void generate(const fixed_point& position, const text_layout& layout, int characters_count,
+                  ivector<sprite_ptr>& output_sprites) const;
+
     /**
      * @brief Generates text sprites for the given single line of text.
      * @param x Horizontal position of the first generated sprite, considering the current alignment.
@@ -45,6 +45,36 @@ namespace bn::sprite_tiles
      */
     [[nodiscard]] int available_items_count();
 
+    /**
+     * @brief Returns the number of tiles of the largest block of contiguous available sprite tiles.
+     *
+     * If it is less than available_tiles_count(), sprite tiles VRAM is fragmented.
+     */
+    [[nodiscard]] int largest_available_block_tiles_count();
+
+    /**
+     * @brief Returns the maximum number of bytes of sprite tiles that can be moved in VRAM per frame
+     * to reduce its fragmentation.
+     *
+     * If it is zero, sprite tiles are never moved.
+     */
+    [[nodiscard]] int compaction_bytes_per_frame();
+
+    /**
+     * @brief Sets the maximum number of bytes of sprite tiles that can be moved in VRAM per frame
+     * to reduce its fragmentation.
+     *
+     * Moved tiles are reloaded from their source data in the next VBlank,
+     * and the sprites and H-Blank effects that reference them are updated automatically.
+     *
+     * Allocated tiles (the ones without source data) and tiles bigger than the given budget are never moved.
+     *
+     * Keep in mind that sprite_tiles_ptr::id() can change when tiles are moved.
+     *
+     * @param bytes Maximum number of bytes of sprite tiles to move per frame (zero disables compaction).
+     */
+    void set_compaction_bytes_per_frame(int bytes);
+
     /**
      * @brief Logs the current status of the sprite tiles manager.
      */
@@ -283,7 +283,7 @@ public:
                         zeros *= 10;
                     }
 
-                    auto fraction_result = unsigned((uint64_t(fraction) * zeros) / value.scale());
+                    auto fraction_result = unsigned((uint64_t(fraction) * zeros) >> Precision);
 
                     if(fraction_result)
                     {
@@ -294,6 +294,34 @@ public:
         }
     }
 
+    /**
+     * @brief Appends the character representation of the given int value to the managed string,
+     * padded with leading zeros.
+     * @param value Value to append.
+     * @param digits_count Minimum number of digits to append (sign excluded), in the range [1..10].
+     */
+    void append_padded(int value, int digits_count);
+
+    /**
+     * @brief Appends the character representation of the given unsigned value to the managed string,
+     * padded with leading zeros.
+     * @param value Value to append.
+     * @param digits_count Minimum number of digits to append, in the range [1..10].
+     */
+    void append_padded(unsigned value, int digits_count);
+
+    /**
+     * @brief Appends the character representation of the given fixed point value to the managed string
+     * with a fixed number of decimals, ignoring the current precision.
+     * @param value Value to append.
+     * @param decimals Number of fractional digits to append (truncated), in the range [0..9].
+     */
+    template<int Precision>
+    void append_fixed(fixed_t<Precision> value, int decimals)
+    {
+        _append_fixed(value.data(), Precision, decimals);
+    }
+
     /**
      * @brief Appends the character representation of the given parameters to the managed string.
      */
@@ -342,6 +370,10 @@ private:
     int _precision = 6;
 
     void _append_fraction(unsigned fraction_result, int fraction_digits);
+
+    void _append_digits(unsigned value, int min_digits_count);
+
+    void _append_fixed(int data, int precision, int decimals);
 };
 
 
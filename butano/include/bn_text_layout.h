@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_TEXT_LAYOUT_H
+#define BN_TEXT_LAYOUT_H
+
+/**
+ * @file
+ * bn::text_layout header file.
+ *
+ * @ingroup text
+ */
+
+#include "bn_span.h"
+#include "bn_sprite_text_generator.h"
+
+namespace bn
+{
+
+/**
+ * @brief Splits a multi-line text in lines that fit in a box of the given width.
+ *
+ * Lines are broken in explicit newlines ('\\n') and, when the next character doesn't fit in the box,
+ * in the last space of the line (or before the character if the line doesn't have spaces).
+ *
+ * The layout is calculated in one pass in the constructor, so it should be kept alive as long as the text
+ * doesn't change to avoid calculating text widths again.
+ *
+ * The referenced text is not copied, so it should outlive the text_layout to avoid dangling references.
+ *
+ * @ingroup text
+ */
+class text_layout
+{
+
+public:
+    using alignment_type = sprite_text_generator::alignment_type; //!< Horizontal alignment type alias.
+
+    static constexpr int max_lines = 16; //!< Maximum number of lines.
+    static constexpr int max_characters = 512; //!< Maximum number of UTF-8 characters (line breaks included).
+
+    /**
+     * @brief Line info.
+     */
+    struct line_type
+    {
+        int16_t text_position = 0; //!< Position in bytes of the first character of the line in the input text.
+        int16_t text_size = 0; //!< Size in bytes of the line (line break excluded).
+        int16_t characters_position = 0; //!< Index of the first character of the line.
+        int16_t characters_count = 0; //!< Number of characters of the line (line break excluded).
+        int16_t x = 0; //!< Horizontal offset in pixels of the line in the box, considering the alignment.
+        int16_t width = 0; //!< Width in pixels of the line.
+    };
+
+    /**
+     * @brief Constructor.
+     * @param font Sprite font used to calculate text widths.
+     * @param text Multi-line text to split in lines.
+     * @param box_width Width in pixels of the box in which the text must fit.
+     * @param alignment Horizontal alignment of each line in the box.
+     */
+    text_layout(const sprite_font& font, const string_view& text, int box_width,
+                alignment_type alignment = alignment_type::LEFT);
+
+    /**
+     * @brief Returns the sprite font used to calculate text widths.
+     */
+    [[nodiscard]] const sprite_font& font() const
+    {
+        return _font;
+    }
+
+    /**
+     * @brief Returns the referenced multi-line text.
+     */
+    [[nodiscard]] const string_view& text() const
+    {
+        return _text;
+    }
+
+    /**
+     * @brief Returns the width in pixels of the box in which the text must fit.
+     */
+    [[nodiscard]] int box_width() const
+    {
+        return _box_width;
+    }
+
+    /**
+     * @brief Returns the horizontal alignment of each line in the box.
+     */
+    [[nodiscard]] alignment_type alignment() const
+    {
+        return _alignment;
+    }
+
+    /**
+     * @brief Returns the info of all lines.
+     */
+    [[nodiscard]] span<const line_type> lines() const
+    {
+        return span<const line_type>(_lines, _lines_count);
+    }
+
+    /**
+     * @brief Returns the number of lines.
+     */
+    [[nodiscard]] int lines_count() const
+    {
+        return _lines_count;
+    }
+
+    /**
+     * @brief Returns the number of UTF-8 characters of the text (line breaks included).
+     */
+    [[nodiscard]] int characters_count() const
+    {
+        return _characters_count;
+    }
+
+    /**
+     * @brief Returns the text of the specified line (line break excluded).
+     */
+    [[nodiscard]] string_view line_text(int line_index) const
+    {
+        BN_ASSERT(line_index >= 0 && line_index < _lines_count, "Invalid line index: ", line_index);
+
+        const line_type& line = _lines[line_index];
+        return string_view(_text.data() + line.text_position, line.text_size);
+    }
+
+    /**
+     * @brief Returns the first characters of the text of the specified line.
+     * @param line_index Index of the line.
+     * @param characters_count Maximum number of characters to return.
+     * @return Text of the first characters of the specified line (line break excluded).
+     *
+     * It takes constant time, so it can be called each frame to reveal a text character by character.
+     */
+    [[nodiscard]] string_view line_text(int line_index, int characters_count) const;
+
+    /**
+     * @brief Returns the index of the line which contains the specified character.
+     *
+     * It takes constant time, so it can be called each frame to reveal a text character by character.
+     */
+    [[nodiscard]] int line_index(int character_index) const
+    {
+        BN_ASSERT(character_index >= 0 && character_index < _characters_count,
+                  "Invalid character index: ", character_index);
+
+        return _character_lines[character_index];
+    }
+
+private:
+    sprite_font _font;
+    string_view _text;
+    line_type _lines[max_lines];
+    int16_t _character_ends[max_characters];
+    uint8_t _character_lines[max_characters];
+    int16_t _box_width;
+    int16_t _characters_count = 0;
+    int8_t _lines_count = 0;
+    alignment_type _alignment;
+};
+
+}
+
+#endif
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_TWEEN_SYSTEM_H
+#define BN_TWEEN_SYSTEM_H
+
+/**
+ * @file
+ * bn::tween_system header file.
+ *
+ * @ingroup template_action
+ */
+
+#include "bn_fixed.h"
+#include "bn_limits.h"
+#include "bn_vector.h"
+
+namespace bn
+{
+
+/**
+ * @brief Available easing curves for tween_system.
+ *
+ * @ingroup template_action
+ */
+enum class tween_easing_type : uint8_t
+{
+    LINEAR, //!< Constant speed.
+    QUAD_IN, //!< Quadratic acceleration from zero velocity.
+    QUAD_OUT, //!< Quadratic deceleration to zero velocity.
+    QUAD_IN_OUT, //!< Quadratic acceleration until halfway, then deceleration.
+    CUBIC_IN, //!< Cubic acceleration from zero velocity.
+    CUBIC_OUT, //!< Cubic deceleration to zero velocity.
+    SMOOTH_STEP, //!< Hermite interpolation (3 * t^2 - 2 * t^3).
+};
+
+
+/**
+ * @brief Applies the given easing curve to the given progress.
+ * @param easing Easing curve to apply.
+ * @param progress Progress in the range [0..1].
+ * @return Eased progress in the range [0..1].
+ *
+ * @ingroup template_action
+ */
+[[nodiscard]] constexpr fixed tween_ease(tween_easing_type easing, fixed progress)
+{
+    // Values are in the range [0..1], so products can't overflow without 64-bit multiplications:
+    switch(easing)
+    {
+
+    case tween_easing_type::LINEAR:
+        return progress;
+
+    case tween_easing_type::QUAD_IN:
+        return progress.unsafe_multiplication(progress);
+
+    case tween_easing_type::QUAD_OUT:
+        return progress.unsafe_multiplication(2 - progress);
+
+    case tween_easing_type::QUAD_IN_OUT:
+        if(progress < fixed(0.5))
+        {
+            return progress.unsafe_multiplication(progress) * 2;
+        }
+        else
+        {
+            fixed inverse_progress = 1 - progress;
+            return 1 - (inverse_progress.unsafe_multiplication(inverse_progress) * 2);
+        }
+
+    case tween_easing_type::CUBIC_IN:
+        return progress.unsafe_multiplication(progress).unsafe_multiplication(progress);
+
+    case tween_easing_type::CUBIC_OUT:
+        {
+            fixed inverse_progress = 1 - progress;
+            return 1 - inverse_progress.unsafe_multiplication(inverse_progress).unsafe_multiplication(
+                        inverse_progress);
+        }
+
+    case tween_easing_type::SMOOTH_STEP:
+        return progress.unsafe_multiplication(progress).unsafe_multiplication(3 - (progress * 2));
+
+    default:
+        BN_ERROR("Invalid easing: ", int(easing));
+        return progress;
+    }
+}
+
+
+/**
+ * @brief Modifies the property of multiple values until they reach their final states, following easing curves.
+ *
+ * Unlike to_value_template_action, all tweens of the same property are stored in a single object
+ * with a struct of arrays layout, so they are updated in one pass.
+ *
+ * Tweens are removed when they are finished, so their order is not kept.
+ *
+ * Property must be fixed or fixed_point, since it is interpolated by multiplying it with an eased progress.
+ *
+ * @tparam Value Value to modify.
+ * @tparam Property Property of the value to modify.
+ * @tparam PropertyManager Reads and writes the property of the value to modify.
+ * @tparam MaxSize Maximum number of tweens.
+ *
+ * @ingroup template_action
+ */
+template<typename Value, typename Property, class PropertyManager, int MaxSize>
+class tween_system
+{
+    static_assert(MaxSize > 0);
+
+public:
+    /**
+     * @brief Returns the number of active tweens.
+     */
+    [[nodiscard]] int size() const
+    {
+        return _values.size();
+    }
+
+    /**
+     * @brief Returns the maximum number of tweens.
+     */
+    [[nodiscard]] constexpr int max_size() const
+    {
+        return MaxSize;
+    }
+
+    /**
+     * @brief Indicates if there's no active tweens.
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return _values.empty();
+    }
+
+    /**
+     * @brief Indicates if it can't hold more tweens.
+     */
+    [[nodiscard]] bool full() const
+    {
+        return _values.full();
+    }
+
+    /**
+     * @brief Adds a tween.
+     * @param value Value to copy.
+     * @param duration_updates Number of times that the tween must be updated
+     * until the property is equal to final_property.
+     * @param final_property Property when the tween is updated duration_updates times.
+     * @param easing Easing curve to follow.
+     */
+    void add(const Value& value, int duration_updates, const Property& final_property,
+             tween_easing_type easing = tween_easing_type::LINEAR)
+    {
+        BN_BASIC_ASSERT(! full(), "No more tweens available");
+
+        _values.push_back(value);
+        _init_back(duration_updates, final_property, easing);
+    }
+
+    /**
+     * @brief Adds a tween.
+     * @param value Value to move.
+     * @param duration_updates Number of times that the tween must be updated
+     * until the property is equal to final_property.
+     * @param final_property Property when the tween is updated duration_updates times.
+     * @param easing Easing curve to follow.
+     */
+    void add(Value&& value, int duration_updates, const Property& final_property,
+             tween_easing_type easing = tween_easing_type::LINEAR)
+    {
+        BN_BASIC_ASSERT(! full(), "No more tweens available");
+
+        _values.push_back(move(value));
+        _init_back(duration_updates, final_property, easing);
+    }
+
+    /**
+     * @brief Removes all tweens which modify the given value, without modifying its property.
+     * @param value Value to search for.
+     * @return Number of removed tweens.
+     */
+    int remove(const Value& value)
+    {
+        int result = 0;
+
+        for(int index = 0; index < _values.size(); )
+        {
+            if(_values[index] == value)
+            {
+                _erase(index);
+                ++result;
+            }
+            else
+            {
+                ++index;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Removes all tweens without modifying the properties of their values.
+     */
+    void clear()
+    {
+        _values.clear();
+    }
+
+    /**
+     * @brief Updates all tweens, removing the finished ones.
+     */
+    void update()
+    {
+        for(int index = 0; index < _values.size(); )
+        {
+            int elapsed_updates = _elapsed_updates[index] + 1;
+
+            if(elapsed_updates == _duration_updates[index]) [[unlikely]]
+            {
+                PropertyManager::set(_initial_properties[index] + _delta_properties[index], _values[index]);
+                _erase(index);
+            }
+            else
+            {
+                // Progress is calculated with 28 bits of precision and rounded to fixed precision to reduce the error.
+                // elapsed_updates < duration_updates, so the product can't overflow:
+                unsigned progress_product = unsigned(elapsed_updates) * _duration_reciprocals[index];
+                auto progress_data = int((progress_product + (1U << 15)) >> 16);
+                fixed eased_progress = tween_ease(_easings[index], fixed::from_data(progress_data));
+                _elapsed_updates[index] = uint16_t(elapsed_updates);
+
+                // Half precision multiplications would quantize progress to 1/64:
+                Property delta_property = _delta_properties[index].safe_multiplication(eased_progress);
+                PropertyManager::set(_initial_properties[index] + delta_property, _values[index]);
+                ++index;
+            }
+        }
+    }
+
+private:
+    vector<Value, MaxSize> _values;
+    Property _initial_properties[MaxSize];
+    Property _delta_properties[MaxSize];
+    unsigned _duration_reciprocals[MaxSize];
+    uint16_t _elapsed_updates[MaxSize];
+    uint16_t _duration_updates[MaxSize];
+    tween_easing_type _easings[MaxSize];
+
+    void _init_back(int duration_updates, const Property& final_property, tween_easing_type easing)
+    {
+        BN_ASSERT(duration_updates > 0 && duration_updates <= numeric_limits<uint16_t>::max(),
+                  "Invalid duration updates: ", duration_updates);
+
+        int index = _values.size() - 1;
+        Property initial_property = PropertyManager::get(_values[index]);
+        _initial_properties[index] = initial_property;
+        _delta_properties[index] = final_property - initial_property;
+        _duration_reciprocals[index] = (1U << 28) / unsigned(duration_updates);
+        _elapsed_updates[index] = 0;
+        _duration_updates[index] = uint16_t(duration_updates);
+        _easings[index] = easing;
+    }
+
+    void _erase(int index)
+    {
+        int last_index = _values.size() - 1;
+
+        if(index != last_index)
+        {
+            _values[index] = move(_values[last_index]);
+            _initial_properties[index] = _initial_properties[last_index];
+            _delta_properties[index] = _delta_properties[last_index];
+            _duration_reciprocals[index] = _duration_reciprocals[last_index];
+            _elapsed_updates[index] = _elapsed_updates[last_index];
+            _duration_updates[index] = _duration_updates[last_index];
+            _easings[index] = _easings[last_index];
+        }
+
+        _values.pop_back();
+    }
+};
+
+}
+
+#endif
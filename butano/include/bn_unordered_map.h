@@ -71,11 +71,11 @@ public:
         iterator& operator++()
         {
             size_type index = _index;
-            size_type last_valid_index = _map->_last_valid_index;
-            const bool* allocated = _map->_allocated;
+            size_type last_valid_index = min(_map->_last_valid_index, _limit_index - 1);
+            const uint16_t* distances = _map->_distances;
             ++index;
 
-            while(index <= last_valid_index && ! allocated[index])
+            while(index <= last_valid_index && ! distances[index])
             {
                 ++index;
             }
@@ -97,10 +97,10 @@ public:
         {
             int index = _index;
             int first_valid_index = _map->_first_valid_index;
-            const bool* allocated = _map->_allocated;
+            const uint16_t* distances = _map->_distances;
             --index;
 
-            while(index >= first_valid_index && ! allocated[index])
+            while(index >= first_valid_index && ! distances[index])
             {
                 --index;
             }
@@ -167,10 +167,19 @@ public:
         friend class iunordered_map;
 
         size_type _index;
+        size_type _limit_index;
         iunordered_map* _map;
 
         iterator(size_type index, iunordered_map& map) :
             _index(index),
+            _limit_index(map.max_size()),
+            _map(&map)
+        {
+        }
+
+        iterator(size_type index, size_type limit_index, iunordered_map& map) :
+            _index(index),
+            _limit_index(limit_index),
             _map(&map)
         {
         }
@@ -205,6 +214,7 @@ public:
          */
         const_iterator(const iterator& it) :
             _index(it._index),
+            _limit_index(it._limit_index),
             _map(it._map)
         {
         }
@@ -216,11 +226,11 @@ public:
         const_iterator& operator++()
         {
             size_type index = _index;
-            size_type last_valid_index = _map->_last_valid_index;
-            const bool* allocated = _map->_allocated;
+            size_type last_valid_index = min(_map->_last_valid_index, _limit_index - 1);
+            const uint16_t* distances = _map->_distances;
             ++index;
 
-            while(index <= last_valid_index && ! allocated[index])
+            while(index <= last_valid_index && ! distances[index])
             {
                 ++index;
             }
@@ -242,10 +252,10 @@ public:
         {
             int index = _index;
             int first_valid_index = _map->_first_valid_index;
-            const bool* allocated = _map->_allocated;
+            const uint16_t* distances = _map->_distances;
             --index;
 
-            while(index >= first_valid_index && ! allocated[index])
+            while(index >= first_valid_index && ! distances[index])
             {
                 --index;
             }
@@ -297,10 +307,12 @@ public:
         friend class iterator;
 
         size_type _index;
+        size_type _limit_index;
         const iunordered_map* _map;
 
         const_iterator(size_type index, const iunordered_map& map) :
             _index(index),
+            _limit_index(map.max_size()),
             _map(&map)
         {
         }
@@ -325,13 +337,13 @@ public:
         if(_size)
         {
             pointer storage = _storage;
-            bool* allocated = _allocated;
+            const uint16_t* distances = _distances;
             size_type first_valid_index = _first_valid_index;
             size_type last_valid_index = _last_valid_index;
 
             for(size_type index = first_valid_index; index <= last_valid_index; ++index)
             {
-                if(allocated[index])
+                if(distances[index])
                 {
                     storage[index].~value_type();
                 }
@@ -610,25 +622,7 @@ public:
             return end();
         }
 
-        const_pointer storage = _storage;
-        const bool* allocated = _allocated;
-        key_equal key_equal_functor;
-        size_type index = _index(key_hash);
-        size_type max_size = _max_size_minus_one + 1;
-        size_type its = 0;
-
-        while(its < max_size && allocated[index])
-        {
-            if(key_equal_functor(key, storage[index].first))
-            {
-                return iterator(index, *this);
-            }
-
-            index = _index(index + 1);
-            ++its;
-        }
-
-        return end();
+        return iterator(_find_index(_index(key_hash), _hash_fragment(key_hash), key), *this);
     }
 
     /**
@@ -731,35 +725,24 @@ public:
 
     /**
      * @brief Inserts a moved (Key, Value) pair.
+     *
+     * Unlike `std::unordered_map`, it doesn't offer pointer stability.
+     *
      * @param key_hash Hash of the key to insert.
      * @param value (Key, Value) pair to insert.
      * @return Iterator pointing to the inserted (Key, Value) pair.
      */
     iterator insert_hash(hash_type key_hash, value_type&& value)
     {
-        size_type index = _index(key_hash);
-        pointer storage = _storage;
-        bool* allocated = _allocated;
-        key_equal key_equal_functor;
-        size_type current_index = index;
+        size_type home_index = _index(key_hash);
+        unsigned hash_fragment = _hash_fragment(key_hash);
 
-        while(allocated[current_index])
+        if(_find_index(home_index, hash_fragment, value.first) <= _max_size_minus_one)
         {
-            if(key_equal_functor(value.first, storage[current_index].first))
-            {
-                return end();
-            }
-
-            current_index = _index(current_index + 1);
-            BN_BASIC_ASSERT(current_index != index, "All indices are allocated");
+            return end();
         }
 
-        new(storage + current_index) value_type(move(value));
-        allocated[current_index] = true;
-        _first_valid_index = min(_first_valid_index, current_index);
-        _last_valid_index = max(_last_valid_index, current_index);
-        ++_size;
-        return iterator(current_index, *this);
+        return iterator(_insert(home_index, hash_fragment, move(value)), *this);
     }
 
     /**
@@ -949,110 +932,19 @@ public:
      */
     iterator erase(const const_iterator& position)
     {
-        bool* allocated = _allocated;
         size_type index = position._index;
-        BN_BASIC_ASSERT(allocated[index], "Index is not allocated: ", index);
+        const uint16_t* distances = _distances;
+        BN_BASIC_ASSERT(distances[index], "Index is not allocated: ", index);
 
-        pointer storage = _storage;
-        storage[index].~value_type();
-        allocated[index] = false;
-        --_size;
+        size_type limit_index = _erased_limit_index(index, _erase(index), position._limit_index);
 
-        if(! _size)
+        // The next element (if any) has been shifted back to the erased index:
+        for(size_type last_index = min(_last_valid_index, limit_index - 1); index <= last_index; ++index)
         {
-            _first_valid_index = max_size();
-            _last_valid_index = 0;
-            return end();
-        }
-
-        size_type first_valid_index = _first_valid_index;
-
-        if(index == first_valid_index)
-        {
-            while(! allocated[first_valid_index])
+            if(distances[index])
             {
-                ++first_valid_index;
+                return iterator(index, limit_index, *this);
             }
-
-            _first_valid_index = first_valid_index;
-        }
-
-        size_type last_valid_index = _last_valid_index;
-
-        if(index == last_valid_index)
-        {
-            while(! allocated[last_valid_index])
-            {
-                --last_valid_index;
-            }
-
-            _last_valid_index = last_valid_index;
-        }
-
-        size_type next_index = _index(index + 1);
-        int reinsert_count = 0;
-
-        while(allocated[next_index])
-        {
-            ++reinsert_count;
-            next_index = _index(next_index + 1);
-        }
-
-        next_index = _index(index + 1);
-
-        for(int reinsert_index = 0; reinsert_index < reinsert_count; ++reinsert_index)
-        {
-            value_type temp_value(move(storage[next_index]));
-            storage[next_index].~value_type();
-            allocated[next_index] = false;
-            --_size;
-
-            if(_size)
-            {
-                first_valid_index = _first_valid_index;
-
-                if(next_index == first_valid_index)
-                {
-                    while(! allocated[first_valid_index])
-                    {
-                        ++first_valid_index;
-                    }
-
-                    _first_valid_index = first_valid_index;
-                }
-
-                last_valid_index = _last_valid_index;
-
-                if(next_index == last_valid_index)
-                {
-                    while(! allocated[last_valid_index])
-                    {
-                        --last_valid_index;
-                    }
-
-                    _last_valid_index = last_valid_index;
-                }
-            }
-            else
-            {
-                _first_valid_index = max_size();
-                _last_valid_index = 0;
-            }
-
-            insert(move(temp_value));
-            next_index = _index(next_index + 1);
-        }
-
-        last_valid_index = _last_valid_index;
-
-        while(index <= last_valid_index)
-        {
-            if(allocated[index])
-            {
-                return iterator(index, *this);
-            }
-
-            ++index;
         }
 
         return end();
@@ -1106,31 +998,24 @@ public:
     {
         size_type erased_count = 0;
         pointer storage = _storage;
-        bool* allocated = _allocated;
-        size_type first_valid_index = max_size();
-        size_type last_valid_index = 0;
+        const uint16_t* distances = _distances;
+        size_type index = _first_valid_index;
+        size_type limit_index = max_size();
 
-        for(size_type index = _first_valid_index, last = _last_valid_index; index <= last; ++index)
+        while(index <= _last_valid_index && index < limit_index)
         {
-            if(allocated[index])
+            if(distances[index] && pred(storage[index]))
             {
-                if(allocated[index] && pred(storage[index]))
-                {
-                    storage[index].~value_type();
-                    allocated[index] = false;
-                    ++erased_count;
-                }
-                else
-                {
-                    first_valid_index = min(index, first_valid_index);
-                    last_valid_index = max(index, last_valid_index);
-                }
+                // The next element (if any) is shifted back to this index, so it must be checked again:
+                limit_index = _erased_limit_index(index, _erase(index), limit_index);
+                ++erased_count;
+            }
+            else
+            {
+                ++index;
             }
         }
 
-        _size -= erased_count;
-        _first_valid_index = first_valid_index;
-        _last_valid_index = last_valid_index;
         return erased_count;
     }
 
@@ -1148,31 +1033,29 @@ public:
 
             pointer storage = _storage;
             pointer other_storage = other._storage;
-            bool* allocated = _allocated;
-            bool* other_allocated = other._allocated;
-            size_type size = _size;
-            size_type first_valid_index = min(_first_valid_index, other._first_valid_index);
-            size_type last_valid_index = max(_last_valid_index, other._last_valid_index);
+            const uint16_t* other_distances = other._distances;
+            const uint8_t* other_hash_fragments = other._hash_fragments;
 
-            for(size_type index = first_valid_index; index <= last_valid_index; ++index)
+            for(size_type index = other._first_valid_index, last = other._last_valid_index; index <= last; ++index)
             {
-                if(other_allocated[index])
+                if(unsigned distance = other_distances[index])
                 {
-                    if(allocated[index])
+                    size_type home_index = _index(unsigned(index) - distance + 1);
+                    unsigned hash_fragment = other_hash_fragments[index];
+                    value_type& other_value = other_storage[index];
+                    size_type found_index = _find_index(home_index, hash_fragment, other_value.first);
+
+                    if(found_index <= _max_size_minus_one)
                     {
-                        storage[index] = move(other_storage[index]);
+                        storage[found_index].second = move(other_value.second);
                     }
                     else
                     {
-                        new(storage + index) value_type(move(other_storage[index]));
-                        ++size;
+                        _insert(home_index, hash_fragment, move(other_value));
                     }
                 }
             }
 
-            _size = size;
-            _first_valid_index = first_valid_index;
-            _last_valid_index = last_valid_index;
             other.clear();
         }
     }
@@ -1185,7 +1068,7 @@ public:
         if(_size)
         {
             size_type first_valid_index = _first_valid_index;
-            memory::clear(_last_valid_index - first_valid_index + 1, _allocated[first_valid_index]);
+            memory::clear(_last_valid_index - first_valid_index + 1, _distances[first_valid_index]);
             _first_valid_index = _max_size_minus_one + 1;
             _last_valid_index = 0;
             _size = 0;
@@ -1201,15 +1084,15 @@ public:
         if(_size)
         {
             pointer storage = _storage;
-            bool* allocated = _allocated;
+            uint16_t* distances = _distances;
             size_type first_valid_index = _first_valid_index;
             size_type last_valid_index = _last_valid_index;
 
             for(size_type index = first_valid_index; index <= last_valid_index; ++index)
             {
-                if(allocated[index])
+                if(distances[index])
                 {
-                    allocated[index] = false;
+                    distances[index] = 0;
                     storage[index].~value_type();
                 }
             }
@@ -1278,37 +1161,42 @@ public:
 
             pointer storage = _storage;
             pointer other_storage = other._storage;
-            bool* allocated = _allocated;
-            bool* other_allocated = other._allocated;
+            uint16_t* distances = _distances;
+            uint16_t* other_distances = other._distances;
+            uint8_t* hash_fragments = _hash_fragments;
+            uint8_t* other_hash_fragments = other._hash_fragments;
             size_type first_valid_index = min(_first_valid_index, other._first_valid_index);
             size_type last_valid_index = max(_last_valid_index, other._last_valid_index);
 
             for(size_type index = first_valid_index; index <= last_valid_index; ++index)
             {
-                if(other_allocated[index])
+                if(other_distances[index])
                 {
-                    if(allocated[index])
+                    if(distances[index])
                     {
-                        bn::swap(storage[index], other_storage[index]);
+                        value_type temp_value(move(storage[index]));
+                        storage[index].~value_type();
+                        new(storage + index) value_type(move(other_storage[index]));
+                        other_storage[index].~value_type();
+                        new(other_storage + index) value_type(move(temp_value));
                     }
                     else
                     {
                         new(storage + index) value_type(move(other_storage[index]));
                         other_storage[index].~value_type();
-                        other_allocated[index] = false;
-                        allocated[index] = true;
                     }
                 }
                 else
                 {
-                    if(allocated[index])
+                    if(distances[index])
                     {
                         new(other_storage + index) value_type(move(storage[index]));
                         storage[index].~value_type();
-                        allocated[index] = false;
-                        other_allocated[index] = true;
                     }
                 }
+
+                bn::swap(distances[index], other_distances[index]);
+                bn::swap(hash_fragments[index], other_hash_fragments[index]);
             }
 
             bn::swap(_size, other._size);
@@ -1338,29 +1226,41 @@ public:
      */
     [[nodiscard]] friend bool operator==(const iunordered_map& a, const iunordered_map& b)
     {
-        size_type first_valid_index = a._first_valid_index;
-        size_type last_valid_index = a._last_valid_index;
-
-        if(a._size != b._size || first_valid_index != b._first_valid_index || last_valid_index != b._last_valid_index)
+        if(a._size != b._size)
         {
             return false;
         }
 
         const_pointer a_storage = a._storage;
-        const_pointer b_storage = b._storage;
-        const bool* a_allocated = a._allocated;
-        const bool* b_allocated = b._allocated;
+        const uint16_t* a_distances = a._distances;
+        const uint8_t* a_hash_fragments = a._hash_fragments;
+        bool same_max_size = a._max_size_minus_one == b._max_size_minus_one;
 
-        for(size_type index = first_valid_index; index <= last_valid_index; ++index)
+        for(size_type index = a._first_valid_index, last = a._last_valid_index; index <= last; ++index)
         {
-            if(a_allocated[index] != b_allocated[index])
+            if(unsigned distance = a_distances[index])
             {
-                return false;
-            }
+                const_reference a_value = a_storage[index];
 
-            if(a_allocated[index] && a_storage[index] != b_storage[index])
-            {
-                return false;
+                if(same_max_size)
+                {
+                    size_type b_index = b._find_index(a._index(unsigned(index) - distance + 1),
+                                                      a_hash_fragments[index], a_value.first);
+
+                    if(b_index > b._max_size_minus_one || a_value != b._storage[b_index])
+                    {
+                        return false;
+                    }
+                }
+                else
+                {
+                    const_iterator b_it = b.find(a_value.first);
+
+                    if(b_it == b.end() || a_value != *b_it)
+                    {
+                        return false;
+                    }
+                }
             }
         }
 
@@ -1429,9 +1329,10 @@ public:
 protected:
     /// @cond DO_NOT_DOCUMENT
 
-    iunordered_map(reference storage, bool& allocated, size_type max_size) :
+    iunordered_map(reference storage, uint16_t& distances, uint8_t& hash_fragments, size_type max_size) :
         _storage(&storage),
-        _allocated(&allocated),
+        _distances(&distances),
+        _hash_fragments(&hash_fragments),
         _max_size_minus_one(max_size - 1),
         _first_valid_index(max_size)
     {
@@ -1441,45 +1342,83 @@ protected:
     {
         const_pointer other_storage = other._storage;
         pointer storage = _storage;
-        bool* allocated = _allocated;
         size_type first_valid_index = other._first_valid_index;
         size_type last_valid_index = other._last_valid_index;
-        memory::copy(*other._allocated, other.max_size(), *allocated);
 
-        for(size_type index = first_valid_index; index <= last_valid_index; ++index)
+        if(_max_size_minus_one == other._max_size_minus_one)
         {
-            if(allocated[index])
+            const uint16_t* distances = _distances;
+            memory::copy(*other._distances, other.max_size(), *_distances);
+            memory::copy(*other._hash_fragments, other.max_size(), *_hash_fragments);
+
+            for(size_type index = first_valid_index; index <= last_valid_index; ++index)
             {
-                new(storage + index) value_type(other_storage[index]);
+                if(distances[index])
+                {
+                    new(storage + index) value_type(other_storage[index]);
+                }
             }
+
+            _first_valid_index = other._first_valid_index;
+            _last_valid_index = other._last_valid_index;
+            _size = other._size;
         }
+        else
+        {
+            const uint16_t* other_distances = other._distances;
 
-        _first_valid_index = other._first_valid_index;
-        _last_valid_index = other._last_valid_index;
-        _size = other._size;
+            for(size_type index = first_valid_index; index <= last_valid_index; ++index)
+            {
+                if(other_distances[index])
+                {
+                    const_reference other_value = other_storage[index];
+                    hash_type key_hash = hasher()(other_value.first);
+                    _insert(_index(key_hash), _hash_fragment(key_hash), value_type(other_value));
+                }
+            }
+        }
     }
 
     void _assign(iunordered_map&& other)
     {
         pointer other_storage = other._storage;
         pointer storage = _storage;
-        bool* allocated = _allocated;
         size_type first_valid_index = other._first_valid_index;
         size_type last_valid_index = other._last_valid_index;
-        int other_max_size = other.max_size();
-        memory::copy(*other._allocated, other_max_size, *allocated);
 
-        for(size_type index = first_valid_index; index <= last_valid_index; ++index)
+        if(_max_size_minus_one == other._max_size_minus_one)
+        {
+            const uint16_t* distances = _distances;
+            memory::copy(*other._distances, other.max_size(), *_distances);
+            memory::copy(*other._hash_fragments, other.max_size(), *_hash_fragments);
+
+            for(size_type index = first_valid_index; index <= last_valid_index; ++index)
+            {
+                if(distances[index])
+                {
+                    new(storage + index) value_type(move(other_storage[index]));
+                }
+            }
+
+            _first_valid_index = other._first_valid_index;
+            _last_valid_index = other._last_valid_index;
+            _size = other._size;
+        }
+        else
         {
-            if(allocated[index])
+            const uint16_t* other_distances = other._distances;
+
+            for(size_type index = first_valid_index; index <= last_valid_index; ++index)
             {
-                new(storage + index) value_type(move(other_storage[index]));
+                if(other_distances[index])
+                {
+                    value_type& other_value = other_storage[index];
+                    hash_type key_hash = hasher()(other_value.first);
+                    _insert(_index(key_hash), _hash_fragment(key_hash), move(other_value));
+                }
             }
         }
 
-        _first_valid_index = other._first_valid_index;
-        _last_valid_index = other._last_valid_index;
-        _size = other._size;
         other.clear();
     }
 
@@ -1487,7 +1426,8 @@ protected:
 
 private:
     pointer _storage;
-    bool* _allocated;
+    uint16_t* _distances;
+    uint8_t* _hash_fragments;
     size_type _max_size_minus_one;
     size_type _first_valid_index;
     size_type _last_valid_index = 0;
@@ -1497,6 +1437,154 @@ private:
     {
         return key_hash & _max_size_minus_one;
     }
+
+    [[nodiscard]] static unsigned _hash_fragment(hash_type key_hash)
+    {
+        return uint8_t(key_hash ^ (key_hash >> 8) ^ (key_hash >> 16) ^ (key_hash >> 24));
+    }
+
+    [[nodiscard]] size_type _find_index(size_type index, unsigned hash_fragment, const key_type& key) const
+    {
+        const_pointer storage = _storage;
+        const uint16_t* distances = _distances;
+        const uint8_t* hash_fragments = _hash_fragments;
+        key_equal key_equal_functor;
+        unsigned distance = 1;
+
+        // Elements are sorted by their home index, so the search can stop
+        // when an empty index or an element closer to its home index is found:
+        while(distances[index] >= distance)
+        {
+            if(hash_fragments[index] == hash_fragment && key_equal_functor(key, storage[index].first))
+            {
+                return index;
+            }
+
+            index = _index(unsigned(index) + 1);
+            ++distance;
+        }
+
+        return _max_size_minus_one + 1;
+    }
+
+    size_type _insert(size_type index, unsigned hash_fragment, value_type&& value)
+    {
+        BN_BASIC_ASSERT(_size <= _max_size_minus_one, "All indices are allocated");
+
+        pointer storage = _storage;
+        uint16_t* distances = _distances;
+        uint8_t* hash_fragments = _hash_fragments;
+        unsigned distance = 1;
+
+        // Skip elements closer or equal to their home index than the new one:
+        while(distances[index] >= distance)
+        {
+            index = _index(unsigned(index) + 1);
+            ++distance;
+        }
+
+        size_type allocated_index = index;
+
+        if(distances[index])
+        {
+            // Shift the remaining elements of the cluster one index forward:
+            while(distances[allocated_index])
+            {
+                allocated_index = _index(unsigned(allocated_index) + 1);
+            }
+
+            size_type destination_index = allocated_index;
+
+            while(destination_index != index)
+            {
+                size_type source_index = _index(unsigned(destination_index) - 1);
+                new(storage + destination_index) value_type(move(storage[source_index]));
+                storage[source_index].~value_type();
+                distances[destination_index] = uint16_t(distances[source_index] + 1);
+                hash_fragments[destination_index] = hash_fragments[source_index];
+                destination_index = source_index;
+            }
+        }
+
+        new(storage + index) value_type(move(value));
+        distances[index] = uint16_t(distance);
+        hash_fragments[index] = uint8_t(hash_fragment);
+        _first_valid_index = min(_first_valid_index, allocated_index);
+        _last_valid_index = max(_last_valid_index, allocated_index);
+        ++_size;
+        return index;
+    }
+
+    [[nodiscard]] static size_type _erased_limit_index(size_type erased_index, size_type cleared_index,
+                                                       size_type limit_index)
+    {
+        // Elements at or after the limit index have been already visited.
+        // If the shifted cluster wraps around, the first element of the table (already visited) is moved to the last
+        // index. If it doesn't wrap around, the first already visited element could have been shifted back:
+        if(cleared_index < erased_index || (limit_index > erased_index && limit_index <= cleared_index))
+        {
+            --limit_index;
+        }
+
+        return limit_index;
+    }
+
+    size_type _erase(size_type index)
+    {
+        pointer storage = _storage;
+        uint16_t* distances = _distances;
+        uint8_t* hash_fragments = _hash_fragments;
+        storage[index].~value_type();
+
+        // Backward shift deletion (no tombstones):
+        size_type next_index = _index(unsigned(index) + 1);
+
+        while(distances[next_index] > 1)
+        {
+            new(storage + index) value_type(move(storage[next_index]));
+            storage[next_index].~value_type();
+            distances[index] = uint16_t(distances[next_index] - 1);
+            hash_fragments[index] = hash_fragments[next_index];
+            index = next_index;
+            next_index = _index(unsigned(next_index) + 1);
+        }
+
+        distances[index] = 0;
+        --_size;
+
+        if(! _size)
+        {
+            _first_valid_index = _max_size_minus_one + 1;
+            _last_valid_index = 0;
+            return index;
+        }
+
+        size_type first_valid_index = _first_valid_index;
+
+        if(index == first_valid_index)
+        {
+            while(! distances[first_valid_index])
+            {
+                ++first_valid_index;
+            }
+
+            _first_valid_index = first_valid_index;
+        }
+
+        size_type last_valid_index = _last_valid_index;
+
+        if(index == last_valid_index)
+        {
+            while(! distances[last_valid_index])
+            {
+                --last_valid_index;
+            }
+
+            _last_valid_index = last_valid_index;
+        }
+
+        return index;
+    }
 };
 
 
@@ -1504,6 +1592,7 @@ template<typename Key, typename Value, int MaxSize, typename KeyHash, typename K
 class unordered_map : public iunordered_map<Key, Value, KeyHash, KeyEqual>
 {
     static_assert(power_of_two(MaxSize));
+    static_assert(MaxSize <= 32768);
 
 public:
     using key_type = Key; //!< Key type alias.
@@ -1524,7 +1613,7 @@ public:
      */
     unordered_map() :
         iunordered_map<Key, Value, KeyHash, KeyEqual>(
-            *reinterpret_cast<pointer>(_storage_buffer), *_allocated_buffer, MaxSize)
+            *reinterpret_cast<pointer>(_storage_buffer), *_distances_buffer, *_hash_fragments_buffer, MaxSize)
     {
     }
 
@@ -1656,7 +1745,8 @@ private:
     static constexpr unsigned _alignment = alignof(value_type) > alignof(int) ? alignof(value_type) : alignof(int);
 
     alignas(_alignment) char _storage_buffer[sizeof(value_type) * MaxSize];
-    bool _allocated_buffer[MaxSize] = {};
+    uint16_t _distances_buffer[MaxSize] = {};
+    uint8_t _hash_fragments_buffer[MaxSize];
 };
 
 
@@ -22,7 +22,14 @@ namespace bn
      *
      * Can be used as a reference type for all bn::unordered_map containers containing a specific type.
      *
-     * Unlike `std::unordered_map`, it doesn't offer pointer stability when moving or erasing elements.
+     * It uses open addressing with Robin Hood probing: searches of missing keys stop as soon as an element closer
+     * to its home index is found, and erased elements are removed with backward shift deletion (without tombstones).
+     *
+     * Unlike `std::unordered_map`, it doesn't offer pointer stability when inserting, moving or erasing elements:
+     * since Robin Hood probing swaps elements to keep them sorted by home index, every insertion invalidates
+     * all pointers, references and iterators.
+     * Erasures shift back the next elements of the cluster, so they also invalidate them
+     * (except the iterator returned by erase).
      *
      * @tparam Key Key type.
      * @tparam Value Value type.
@@ -39,11 +46,12 @@ namespace bn
      *
      * It doesn't throw exceptions. Instead, asserts are used to ensure valid usage.
      *
-     * Unlike `std::unordered_map`, it doesn't offer pointer stability when moving or erasing elements.
+     * Unlike `std::unordered_map`, it doesn't offer pointer stability when inserting, moving or erasing elements:
+     * every insertion invalidates all pointers, references and iterators (see bn::iunordered_map).
      *
      * @tparam Key Key type.
      * @tparam Value Value type.
-     * @tparam MaxSize Maximum number of elements that can be stored.
+     * @tparam MaxSize Maximum number of elements that can be stored (power of two, up to 32768).
      * @tparam KeyHash Functor used to calculate the hash of a given key.
      * @tparam KeyEqual Functor used for all key comparisons.
      *
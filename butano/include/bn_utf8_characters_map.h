@@ -14,6 +14,8 @@
  */
 
 #include "bn_span.h"
+#include "bn_limits.h"
+#include "bn_algorithm.h"
 #include "bn_utf8_characters_map_ref.h"
 
 namespace bn
@@ -22,6 +24,11 @@ namespace bn
 /**
  * @brief Maps a list of UTF-8 characters to their position in the list.
  *
+ * Latin-1 supplement characters are stored in a direct-index table and the rest of them in a perfect hash table
+ * (hash and displace), so searching for any character requires one item comparison at most.
+ *
+ * Both tables are built at compile time if the map is declared constexpr.
+ *
  * @tparam Utf8Characters UTF-8 characters list to map.
  *
  * @ingroup text
@@ -36,28 +43,69 @@ public:
      */
     constexpr utf8_characters_map()
     {
-        hash<int> hasher;
-        uint16_t character_index = 0;
+        int bucket_starts[_displacements_count + 1] = {};
+        int bucket_characters[_characters_count] = {};
+        int max_bucket_size = 0;
+
+        for(int16_t& latin1_index : _latin1_indexes)
+        {
+            latin1_index = -1;
+        }
 
-        for(const utf8_character& character : Utf8Characters)
+        for(int character_index = 0; character_index < _characters_count; ++character_index)
         {
-            int data = character.data();
-            auto initial_item_index = _item_index(hasher(data));
-            int item_index = initial_item_index;
+            int data = Utf8Characters[character_index].data();
 
-            while(_items[item_index].valid)
+            if(_latin1(data))
             {
-                BN_BASIC_ASSERT(data != _items[item_index].data, "Duplicated UTF-8 characters: ", character_index);
+                int16_t& latin1_index = _latin1_indexes[data - utf8_characters_map_ref::latin1_first];
+                BN_BASIC_ASSERT(latin1_index < 0, "Duplicated UTF-8 characters: ", character_index);
 
-                item_index = _item_index(unsigned(item_index + 1));
-                BN_BASIC_ASSERT(item_index != initial_item_index, "All items are allocated");
+                latin1_index = int16_t(character_index);
             }
+            else
+            {
+                ++bucket_starts[_bucket_index(data) + 1];
+            }
+        }
+
+        for(int bucket_index = 0; bucket_index < _displacements_count; ++bucket_index)
+        {
+            max_bucket_size = max(max_bucket_size, bucket_starts[bucket_index + 1]);
+            bucket_starts[bucket_index + 1] += bucket_starts[bucket_index];
+        }
 
-            item_type& item = _items[item_index];
-            item.data = data;
-            item.index = character_index;
-            item.valid = true;
-            ++character_index;
+        int bucket_ends[_displacements_count] = {};
+
+        for(int bucket_index = 0; bucket_index < _displacements_count; ++bucket_index)
+        {
+            bucket_ends[bucket_index] = bucket_starts[bucket_index];
+        }
+
+        for(int character_index = 0; character_index < _characters_count; ++character_index)
+        {
+            int data = Utf8Characters[character_index].data();
+
+            if(! _latin1(data))
+            {
+                int& bucket_end = bucket_ends[_bucket_index(data)];
+                bucket_characters[bucket_end] = character_index;
+                ++bucket_end;
+            }
+        }
+
+        // Biggest buckets are placed first:
+        for(int bucket_size = max_bucket_size; bucket_size > 0; --bucket_size)
+        {
+            for(int bucket_index = 0; bucket_index < _displacements_count; ++bucket_index)
+            {
+                int bucket_start = bucket_starts[bucket_index];
+
+                if(bucket_starts[bucket_index + 1] - bucket_start == bucket_size)
+                {
+                    _place_bucket(bucket_index, bucket_characters + bucket_start, bucket_size);
+                }
+            }
         }
     }
 
@@ -69,13 +117,15 @@ public:
      */
     [[nodiscard]] constexpr utf8_characters_map_ref reference() const
     {
-        return utf8_characters_map_ref(_items[0], _items_count, Utf8Characters.size());
+        return utf8_characters_map_ref(_items[0], _items_count, _displacements[0], _displacements_count,
+                                       _latin1_indexes[0], _characters_count);
     }
 
 private:
     using item_type = utf8_characters_map_ref::item_type;
 
     static_assert(! Utf8Characters.empty());
+    static_assert(Utf8Characters.size() <= numeric_limits<int16_t>::max());
 
     [[nodiscard]] constexpr static int _calculate_items_count()
     {
@@ -89,13 +139,80 @@ private:
         return result * 2;
     }
 
+    static constexpr int _characters_count = Utf8Characters.size();
     static constexpr int _items_count = _calculate_items_count();
+    static constexpr int _displacements_count = _items_count >= 8 ? _items_count / 4 : 1;
 
     item_type _items[_items_count] = {};
+    uint16_t _displacements[_displacements_count] = {};
+    int16_t _latin1_indexes[utf8_characters_map_ref::latin1_count] = {};
+
+    [[nodiscard]] constexpr static bool _latin1(int data)
+    {
+        return data >= utf8_characters_map_ref::latin1_first && data <= utf8_characters_map_ref::latin1_last;
+    }
 
-    [[nodiscard]] constexpr static int _item_index(unsigned hash)
+    [[nodiscard]] constexpr static int _bucket_index(int data)
     {
-        return int(hash & (_items_count - 1));
+        return utf8_characters_map_ref::bucket_index(data, _displacements_count - 1);
+    }
+
+    [[nodiscard]] constexpr static int _item_index(int data, unsigned displacement)
+    {
+        return utf8_characters_map_ref::item_index(data, displacement, _items_count - 1);
+    }
+
+    constexpr void _place_bucket(int bucket_index, const int* bucket_characters, int bucket_size)
+    {
+        for(unsigned displacement = 0; displacement <= numeric_limits<uint16_t>::max(); ++displacement)
+        {
+            bool valid = true;
+
+            for(int index = 0; index < bucket_size && valid; ++index)
+            {
+                int data = Utf8Characters[bucket_characters[index]].data();
+                int item_index = _item_index(data, displacement);
+
+                if(_items[item_index].valid)
+                {
+                    valid = false;
+                }
+                else
+                {
+                    for(int previous_index = 0; previous_index < index; ++previous_index)
+                    {
+                        int previous_data = Utf8Characters[bucket_characters[previous_index]].data();
+                        BN_BASIC_ASSERT(data != previous_data,
+                                        "Duplicated UTF-8 characters: ", bucket_characters[index]);
+
+                        if(item_index == _item_index(previous_data, displacement))
+                        {
+                            valid = false;
+                            break;
+                        }
+                    }
+                }
+            }
+
+            if(valid)
+            {
+                _displacements[bucket_index] = uint16_t(displacement);
+
+                for(int index = 0; index < bucket_size; ++index)
+                {
+                    int character_index = bucket_characters[index];
+                    int data = Utf8Characters[character_index].data();
+                    item_type& item = _items[_item_index(data, displacement)];
+                    item.data = data;
+                    item.index = unsigned(character_index);
+                    item.valid = true;
+                }
+
+                return;
+            }
+        }
+
+        BN_ERROR("Perfect hash displacement not found: ", bucket_index);
     }
 };
 
@@ -23,6 +23,9 @@ namespace bn
 /**
  * @brief Maps a list of UTF-8 characters to their position in the list.
  *
+ * Latin-1 supplement characters (from U+0080 to U+00FF) are retrieved from a direct-index table
+ * and the rest of them from a perfect hash table built at compile time.
+ *
  * @ingroup text
  */
 class utf8_characters_map_ref
@@ -39,6 +42,10 @@ public:
         bool valid: 1 = false; //!< Indicates if the item is valid or not.
     };
 
+    static constexpr int latin1_first = 0x80; //!< First UTF-8 character data of the direct-index table.
+    static constexpr int latin1_last = 0xFF; //!< Last UTF-8 character data of the direct-index table.
+    static constexpr int latin1_count = latin1_last - latin1_first + 1; //!< Direct-index table size.
+
     /**
      * @brief Default class constructor.
      */
@@ -46,7 +53,7 @@ public:
 
     /**
      * @brief Class constructor.
-     * @param items_ref Reference to a list of map items.
+     * @param items_ref Reference to a list of map items placed with linear probing.
      *
      * Map items are not copied but referenced, so they should outlive the utf8_characters_map_ref
      * to avoid dangling references.
@@ -64,6 +71,36 @@ public:
                   "Invalid characters count: ", characters_count, " - ", items_count);
     }
 
+    /**
+     * @brief Class constructor.
+     * @param items_ref Reference to a list of map items placed with a perfect hash.
+     * @param items_count Referenced map items count.
+     * @param displacements_ref Reference to the perfect hash displacement of each bucket.
+     * @param displacements_count Referenced displacements count.
+     * @param latin1_indexes_ref Reference to the direct-index table of the Latin-1 supplement characters
+     * (-1 if a character is not mapped).
+     * @param characters_count Mapped UTF-8 characters count.
+     *
+     * Referenced data is not copied, so it should outlive the utf8_characters_map_ref
+     * to avoid dangling references.
+     */
+    constexpr utf8_characters_map_ref(
+            const item_type& items_ref, int items_count, const uint16_t& displacements_ref, int displacements_count,
+            const int16_t& latin1_indexes_ref, int characters_count) :
+        _items(&items_ref),
+        _displacements(&displacements_ref),
+        _latin1_indexes(&latin1_indexes_ref),
+        _items_count_minus_one(items_count - 1),
+        _displacements_count_minus_one(displacements_count - 1),
+        _characters_count(characters_count)
+    {
+        BN_ASSERT(power_of_two(items_count), "Items count must be a power of two: ", items_count);
+        BN_ASSERT(power_of_two(displacements_count),
+                  "Displacements count must be a power of two: ", displacements_count);
+        BN_ASSERT(characters_count > 0 && characters_count <= items_count,
+                  "Invalid characters count: ", characters_count, " - ", items_count);
+    }
+
     /**
      * @brief Returns the mapped UTF-8 characters count.
      */
@@ -87,8 +124,26 @@ public:
      */
     [[nodiscard]] constexpr int index(const utf8_character& character) const
     {
-        hash<int> hasher;
         int data = character.data();
+
+        if(_displacements)
+        {
+            if(unsigned(data - latin1_first) < unsigned(latin1_count))
+            {
+                int result = _latin1_indexes[data - latin1_first];
+                BN_BASIC_ASSERT(result >= 0, "UTF-8 character not found: ", data);
+
+                return result;
+            }
+
+            unsigned displacement = _displacements[bucket_index(data, _displacements_count_minus_one)];
+            const item_type& item = _items[item_index(data, displacement, _items_count_minus_one)];
+            BN_BASIC_ASSERT(item.valid && item.data == data, "UTF-8 character not found: ", data);
+
+            return int(item.index);
+        }
+
+        hash<int> hasher;
         int index = _item_index(hasher(data));
         int its = 0;
         int items_count = _items_count_minus_one + 1;
@@ -108,11 +163,47 @@ public:
         return 0;
     }
 
+    /**
+     * @brief Returns the perfect hash bucket of the given UTF-8 character data.
+     * @param data UTF-8 character data.
+     * @param displacements_count_minus_one Displacements count minus one.
+     * @return Bucket index.
+     */
+    [[nodiscard]] constexpr static int bucket_index(int data, int displacements_count_minus_one)
+    {
+        return int((_mix(unsigned(data)) >> 16) & unsigned(displacements_count_minus_one));
+    }
+
+    /**
+     * @brief Returns the perfect hash item index of the given UTF-8 character data.
+     * @param data UTF-8 character data.
+     * @param displacement Displacement of the bucket of the given UTF-8 character data.
+     * @param items_count_minus_one Items count minus one.
+     * @return Item index.
+     */
+    [[nodiscard]] constexpr static int item_index(int data, unsigned displacement, int items_count_minus_one)
+    {
+        return int(_mix(unsigned(data) + (displacement * 0x9E3779B9U)) & unsigned(items_count_minus_one));
+    }
+
 private:
     const item_type* _items = nullptr;
+    const uint16_t* _displacements = nullptr;
+    const int16_t* _latin1_indexes = nullptr;
     int _items_count_minus_one = -1;
+    int _displacements_count_minus_one = -1;
     int _characters_count = 0;
 
+    [[nodiscard]] constexpr static unsigned _mix(unsigned value)
+    {
+        value ^= value >> 16;
+        value *= 0x7FEB352DU;
+        value ^= value >> 15;
+        value *= 0x846CA68BU;
+        value ^= value >> 16;
+        return value;
+    }
+
     [[nodiscard]] constexpr int _item_index(unsigned hash) const
     {
         return int(hash & unsigned(_items_count_minus_one));
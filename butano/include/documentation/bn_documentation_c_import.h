@@ -262,6 +262,8 @@
  * (`true` by default).
  * * `"big"`: optional boolean field which specifies if maps generated with this item are big or not.
  *    If this field is omitted, big maps are generated only if needed.
+ * * `"tiles_group"`: optional field which specifies the name of a bn::regular_bg_tiles_item
+ * shared with other regular backgrounds (see @ref import_regular_bg_tiles_group).
  * * `"tiles_compression"`: optional field which specifies the compression of the tiles data:
  *   * `"none"`: uncompressed data (this is the default option).
  *   * `"lz77"`: LZ77 compressed data.
@@ -306,6 +308,45 @@
  * @endcode
  *
  *
+ * @subsection import_regular_bg_tiles_group Regular background tiles groups
+ *
+ * Regular backgrounds with the same `"tiles_group"` field share a single bn::regular_bg_tiles_item,
+ * so tiles repeated in more than one of them are stored only once.
+ *
+ * For example, from two files named `level_1.json` and `level_2.json` with the following contents:
+ *
+ * @code{.json}
+ * {
+ *     "type": "regular_bg",
+ *     "bpp_mode": "bpp_4",
+ *     "tiles_group": "forest"
+ * }
+ * @endcode
+ *
+ * A header file named `bn_regular_bg_tiles_items_forest.h` is generated in the `build` folder,
+ * and the maps of both regular backgrounds reference its tiles.
+ *
+ * Repeated tiles are reduced across all regular backgrounds of the group,
+ * including flipped tiles if `"flipped_tiles_reduction"` is not disabled.
+ *
+ * All regular backgrounds of a group must have the same BPP mode,
+ * the group can't have more than 1024 tiles and tiles and map compression are not supported.
+ *
+ * Tiles are reused from VRAM while a bn::regular_bg_tiles_ptr referencing them is alive,
+ * so they are not uploaded again when changing the active regular background:
+ *
+ * @code{.cpp}
+ * #include "bn_regular_bg_items_level_1.h"
+ * #include "bn_regular_bg_items_level_2.h"
+ *
+ * bn::regular_bg_tiles_ptr forest_tiles = bn::regular_bg_tiles_items::forest.create_tiles();
+ * bn::optional<bn::regular_bg_ptr> level_bg = bn::regular_bg_items::level_1.create_bg(0, 0);
+ * // ...
+ * level_bg.reset();
+ * level_bg = bn::regular_bg_items::level_2.create_bg(0, 0);
+ * @endcode
+ *
+ *
  * @subsection import_regular_bg_tiles Regular background tiles
  *
  * An image file can contain up to 1024 regular background tiles.
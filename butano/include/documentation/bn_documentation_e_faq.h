@@ -186,6 +186,9 @@
  * To avoid running out of IWRAM, Butano Fighter and Varooom 3D place all scenes in EWRAM.
  * Check their `main.cpp` files to see how it works.
  *
+ * If each scene has its own hot code which doesn't fit in IWRAM at once, it can be placed in IWRAM overlays
+ * with the `BN_CODE_IWRAM_OVERLAY` macro and loaded on scene entry with bn::iwram_overlay::load.
+ *
  *
  * @subsection faq_destroy_ptr How to destroy sprites and backgrounds?
  *
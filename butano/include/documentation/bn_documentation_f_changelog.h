@@ -12,9 +12,53 @@
  * @tableofcontents
  *
  *
- * @section changelog_17_5_1 17.5.1 (next release)
- *
- * GCC14 false build warnings in Butano Fighter fixed.
+ * @section changelog_17_6_0 17.6.0 (next release)
+ *
+ * * Per-frame linear memory arenas added (bn::frame_arena).
+ *   They are reset automatically in bn::core::update.
+ *   They are disabled by default: games must set @ref BN_CFG_FRAME_ARENA_IWRAM_BYTES and
+ *   @ref BN_CFG_FRAME_ARENA_EWRAM_BYTES to use them.
+ * * IWRAM overlays added (bn::iwram_overlay). Code and data can be placed in them with
+ *   the `BN_CODE_IWRAM_OVERLAY` and `BN_DATA_IWRAM_OVERLAY` macros
+ *   and `.bn_iwram_overlay.cpp` files are built in ARM mode.
+ * * bn::profiler::log added.
+ * * `butano_iwram_placement_tool.py` added: it ranks functions by profiled time and ROM wait states
+ *   using the linker map file, and suggests which ones should be placed in IWRAM under a given budget.
+ * * Sampling profiler added (bn::sampling_profiler): it records the interrupted code address with
+ *   a hardware timer interrupt. Results can be symbolized with `butano_sampling_profiler_tool.py`.
+ *   It shares the hardware timer 1 with link communication, so they can't be used at the same time.
+ * * Sprite tiles VRAM can be compacted incrementally with bn::sprite_tiles::set_compaction_bytes_per_frame.
+ * * bn::sprite_tiles::largest_available_block_tiles_count added.
+ * * bn::sprite_text added: it keeps its sprites alive between text updates
+ *   and only redraws the tile columns whose characters have changed.
+ * * bn::bg_text_generator added: prints text in a regular BG map sharing identical tiles between cells.
+ * * bn::utf8_characters_map search performance improved with a perfect hash table and a direct-index table for Latin-1 supplement characters.
+ * * bn::text_layout added: splits a multi-line text in lines in one pass (word wrap, alignment and newlines).
+ * * bn::sprite_text_generator can generate text sprites from a bn::text_layout, revealing it character by character if needed.
+ * * Integer to string conversion performance improved: digits are written directly in the output string by an IWRAM routine instead of using posprintf.
+ * * bn::ostringstream::append_padded and bn::ostringstream::append_fixed added.
+ * * bn::batch_math added: fixed point math functions placed in IWRAM which process arrays of values at once.
+ * * bn::fast_divider added: it divides values by the same integer divisor with a multiplication and a shift instead of calling integer division routines.
+ * * bn::fast_division added: it approximates fixed point divisions with a reciprocal seed LUT and one Newton-Raphson step.
+ * * bn::unordered_map uses Robin Hood probing with hash fragments and backward shift deletion, so searches of missing keys in almost full maps are much faster. Since elements are swapped to keep them sorted, every insertion invalidates all pointers, references and iterators.
+ * * Host (x86) benchmarks added in `tests/host_benchmarks`.
+ * * Headless profiler harness added (`butano/tools/butano_profiler_harness_tool.py`).
+ * * @ref BN_CFG_PROFILER_LOG_FRAMES and @ref BN_CFG_KEYPAD_COMMANDS added.
+ * * bn::profiler::show logs profiling results too.
+ * * `EXTRAFLAGS` make variable allows to add compiler flags without replacing `USERFLAGS`.
+ * * Global palette effects are applied in one pass with per channel LUTs rebuilt only when an effect parameter changes.
+ * * 4BPP color palettes are deduplicated with a 32-bit colors hash generated by the graphics tool, avoiding hash collisions and runtime hash calculations for uncompressed palettes.
+ * * bn::sprite_palettes::reused_palettes_count, bn::sprite_palettes::created_palettes_count, bn::bg_palettes::reused_palettes_count and bn::bg_palettes::created_palettes_count added.
+ * * Shared sprite affine mats added: bn::sprite_affine_mat_ptr::create_shared quantizes the rotation angle and the scale of the given attributes and returns the existing matrix with the same transformation if any, so more than 32 sprites can be rotated and scaled at the same time.
+ * * bn::sprite_affine_mats::shared_count, bn::sprite_affine_mats::shared_by_default and bn::sprite_affine_mats::set_shared_by_default added.
+ * * Camera updates performance improved: each camera keeps lists of its attached sprites and backgrounds, so moving a camera doesn't touch the sprites and backgrounds without camera or attached to other cameras.
+ * * bn::sprite_animation_ptr added: sprite animations updated by the engine in a single pass over packed arrays.
+ * * bn::sprite_streamed_animate_action added: it copies each tile set to a back VRAM slot outside of VBlank and then displays it with a single attributes change.
+ * * bn::tween_system added: it updates multiple tweens of the same property in one pass, following fixed point easing curves.
+ * * Graphics and DMG audio files are rebuilt only when their contents change, and processed files can be shared between builds with the ASSETSCACHE folder.
+ * * Graphics tool: `auto` compressions are selected from compressed sizes calculated in memory, so grit is called at most twice per graphics item.
+ * * Regular backgrounds with the same `tiles_group` share a single bn::regular_bg_tiles_item. See the @ref import_regular_bg_tiles_group import guide to learn how to use them.
+ * * GCC14 false build warnings in Butano Fighter fixed.
  *
  *
  * @section changelog_17_5_0 17.5.0
@@ -352,6 +352,11 @@
  * It allows to measure elapsed time between code blocks defined by the user.
  *
  * It can be enabled or disabled by overloading the definition of @ref BN_CFG_PROFILER_ENABLED.
+ *
+ * `butano/tools/butano_profiler_harness_tool.py` builds projects with the profiler enabled,
+ * runs them in a headless mGBA with scripted keypad input (see @ref BN_CFG_KEYPAD_COMMANDS)
+ * until profiling results are logged (see @ref BN_CFG_PROFILER_LOG_FRAMES)
+ * and compares them against stored baselines (see `tests/profiler_harness/targets.json`).
  */
 
 /**
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_batch_math.h"
+
+#include "bn_math.h"
+#include "../hw/include/bn_hw_batch_math.h"
+
+namespace bn::batch_math
+{
+
+namespace
+{
+    static_assert(sizeof(fixed) == sizeof(int));
+    static_assert(sizeof(fixed_point) == sizeof(int) * 2);
+
+    [[nodiscard]] const int* _data(const fixed* values)
+    {
+        return reinterpret_cast<const int*>(values);
+    }
+
+    [[nodiscard]] int* _data(fixed* values)
+    {
+        return reinterpret_cast<int*>(values);
+    }
+
+    [[nodiscard]] const int* _data(const fixed_point* points)
+    {
+        return reinterpret_cast<const int*>(points);
+    }
+
+    [[nodiscard]] int* _data(fixed_point* points)
+    {
+        return reinterpret_cast<int*>(points);
+    }
+
+    void _transform(fixed a, fixed b, fixed c, fixed d, const fixed_point& translation,
+                    const span<const fixed_point>& input, span<fixed_point> output)
+    {
+        BN_ASSERT(input.size() == output.size(), "Invalid output size: ", input.size(), " - ", output.size());
+
+        int matrix[] = { a.data(), b.data(), c.data(), d.data(), translation.x().data(), translation.y().data() };
+        hw::batch_math::transform_2d(matrix, _data(input.data()), input.size(), _data(output.data()));
+    }
+}
+
+void transform(fixed a, fixed b, fixed c, fixed d, const fixed_point& translation,
+               const span<const fixed_point>& input, span<fixed_point> output)
+{
+    _transform(a, b, c, d, translation, input, output);
+}
+
+void transform(const span<const fixed>& matrix, const span<const fixed>& input_xs,
+               const span<const fixed>& input_ys, const span<const fixed>& input_zs,
+               span<fixed> output_xs, span<fixed> output_ys, span<fixed> output_zs)
+{
+    int points_count = input_xs.size();
+    BN_ASSERT(matrix.size() == 9, "Invalid matrix size: ", matrix.size());
+    BN_ASSERT(input_ys.size() == points_count && input_zs.size() == points_count &&
+              output_xs.size() == points_count && output_ys.size() == points_count &&
+              output_zs.size() == points_count, "Invalid spans size");
+
+    hw::batch_math::transform_3d(_data(matrix.data()), _data(input_xs.data()), _data(input_ys.data()),
+                                 _data(input_zs.data()), points_count, _data(output_xs.data()),
+                                 _data(output_ys.data()), _data(output_zs.data()));
+}
+
+void rotate(fixed degrees_angle, const span<const fixed_point>& input, span<fixed_point> output)
+{
+    pair<fixed, fixed> sin_and_cos = degrees_lut_sin_and_cos(degrees_angle);
+    fixed sin = sin_and_cos.first;
+    fixed cos = sin_and_cos.second;
+    _transform(cos, -sin, sin, cos, fixed_point(), input, output);
+}
+
+void scale(fixed scale, const span<const fixed_point>& input, span<fixed_point> output)
+{
+    _transform(scale, 0, 0, scale, fixed_point(), input, output);
+}
+
+void multiply_add(fixed factor, const span<const fixed_point>& input, span<fixed_point> output)
+{
+    BN_ASSERT(input.size() == output.size(), "Invalid output size: ", input.size(), " - ", output.size());
+
+    hw::batch_math::multiply_add(factor.data(), _data(input.data()), input.size() * 2, _data(output.data()));
+}
+
+void multiply_add(fixed factor, const span<const fixed>& input, span<fixed> output)
+{
+    BN_ASSERT(input.size() == output.size(), "Invalid output size: ", input.size(), " - ", output.size());
+
+    hw::batch_math::multiply_add(factor.data(), _data(input.data()), input.size(), _data(output.data()));
+}
+
+fixed dot(const span<const fixed>& a, const span<const fixed>& b)
+{
+    BN_ASSERT(a.size() == b.size(), "Invalid spans size: ", a.size(), " - ", b.size());
+
+    return fixed::from_data(hw::batch_math::dot(_data(a.data()), _data(b.data()), a.size()));
+}
+
+void reciprocal(const span<const int>& input, span<fixed_t<16>> output)
+{
+    BN_ASSERT(input.size() == output.size(), "Invalid output size: ", input.size(), " - ", output.size());
+
+    hw::batch_math::reciprocal(reinterpret_cast<const int*>(reciprocal_lut.data()), input.data(), input.size(),
+                               reinterpret_cast<int*>(output.data()));
+}
+
+}
@@ -23,7 +23,7 @@ namespace
 
         if(palette_item.bpp() == bpp_mode::BPP_4)
         {
-            uint16_t hash = palettes_bank::colors_hash(colors);
+            unsigned hash = palettes_bank::colors_hash(colors, palette_item.colors_hash());
             id = bg_palettes_bank.find_bpp_4(colors, hash);
 
             if(id < 0)
@@ -52,7 +52,8 @@ namespace
 
         if(palette_item.bpp() == bpp_mode::BPP_4)
         {
-            id = bg_palettes_bank.create_bpp_4(colors, palettes_bank::colors_hash(colors), required);
+            unsigned hash = palettes_bank::colors_hash(colors, palette_item.colors_hash());
+            id = bg_palettes_bank.create_bpp_4(colors, hash, required);
         }
         else
         {
@@ -76,7 +77,8 @@ optional<bg_palette_ptr> bg_palette_ptr::find(const bg_palette_item& palette_ite
 
         if(bpp_4)
         {
-            id = bg_palettes_bank.find_bpp_4(colors, palettes_bank::colors_hash(colors));
+            unsigned hash = palettes_bank::colors_hash(colors, palette_item.colors_hash());
+            id = bg_palettes_bank.find_bpp_4(colors, hash);
         }
         else
         {
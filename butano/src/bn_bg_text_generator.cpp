@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_bg_text_generator.h"
+
+#include "bn_size.h"
+#include "bn_algorithm.h"
+#include "bn_bg_palette_ptr.h"
+#include "bn_bg_palette_item.h"
+#include "bn_regular_bg_tiles_ptr.h"
+#include "bn_regular_bg_map_cell_info.h"
+#include "../hw/include/bn_hw_sprite_tiles.h"
+
+namespace bn
+{
+
+namespace
+{
+    constexpr int max_line_rows = 4;
+    constexpr int band_tiles = bg_text_generator::columns + 1;
+    constexpr int map_width = bg_text_generator::columns * 8;
+
+    [[nodiscard]] int _graphics_index(char character, const utf8_characters_map_ref& utf8_characters_map,
+                                      const char* text_data, int& text_index)
+    {
+        int result;
+
+        if(character <= '~')
+        {
+            result = character - '!';
+            ++text_index;
+        }
+        else
+        {
+            utf8_character utf8_char(text_data[text_index]);
+            result = utf8_characters_map.index(utf8_char) + sprite_font::minimum_graphics;
+            text_index += utf8_char.size();
+        }
+
+        return result;
+    }
+
+    template<typename Function>
+    int _for_each_character(const sprite_font& font, const string_view& text, Function&& function)
+    {
+        const utf8_characters_map_ref& utf8_characters_map = font.utf8_characters_ref();
+        const int8_t* character_widths = font.character_widths_ref().data();
+        int character_width = font.item().shape_size().width();
+        int space_between_characters = font.space_between_characters();
+        int space_width = character_widths ? character_widths[0] : character_width;
+        const char* text_data = text.data();
+        int text_index = 0;
+        int text_size = text.size();
+        int x = 0;
+
+        while(text_index < text_size)
+        {
+            char character = text_data[text_index];
+
+            if(character == ' ')
+            {
+                x += space_width + space_between_characters;
+                ++text_index;
+            }
+            else if(character == '\t')
+            {
+                x += (space_width * 4) + space_between_characters;
+                ++text_index;
+            }
+            else if(character >= '!')
+            {
+                int graphics_index = _graphics_index(character, utf8_characters_map, text_data, text_index);
+                int width = character_widths ? character_widths[graphics_index + 1] : character_width;
+
+                if(width)
+                {
+                    function(graphics_index, x, width);
+                    x += width;
+                }
+
+                x += space_between_characters;
+            }
+            else
+            {
+                BN_ERROR("Invalid character: ", character, " (text: ", text, ")");
+            }
+        }
+
+        return x;
+    }
+
+    [[nodiscard]] bool _empty_tile(const tile& tile_data)
+    {
+        uint32_t result = 0;
+
+        for(uint32_t value : tile_data.data)
+        {
+            result |= value;
+        }
+
+        return ! result;
+    }
+
+    [[nodiscard]] unsigned _tile_hash(const tile& tile_data)
+    {
+        unsigned result = 2166136261U;
+
+        for(uint32_t value : tile_data.data)
+        {
+            result = (result ^ value) * 16777619U;
+        }
+
+        return result;
+    }
+
+    [[nodiscard]] bool _equal_tiles(const tile& a, const tile& b)
+    {
+        for(int index = 0; index < 8; ++index)
+        {
+            if(a.data[index] != b.data[index])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] regular_bg_map_ptr _allocate_map(const sprite_font& font, int tiles_count)
+    {
+        BN_ASSERT(tiles_count >= 2 && tiles_count <= bg_text_generator::max_tiles,
+                  "Invalid tiles count: ", tiles_count);
+
+        const sprite_palette_item& palette_item = font.item().palette_item();
+        bg_palette_item bg_palette_item(palette_item.colors_ref(), bpp_mode::BPP_4, palette_item.compression(),
+                                        palette_item.colors_hash());
+        regular_bg_tiles_ptr tiles = regular_bg_tiles_ptr::allocate(tiles_count, bpp_mode::BPP_4);
+        return regular_bg_map_ptr::allocate(
+                    size(bg_text_generator::columns, bg_text_generator::rows), move(tiles),
+                    bg_palette_item.create_palette());
+    }
+}
+
+bg_text_generator::bg_text_generator(const sprite_font& font, int tiles_count) :
+    _font(font),
+    _map(_allocate_map(font, tiles_count)),
+    _tiles_count(int16_t(tiles_count))
+{
+    const sprite_shape_size& shape_size = font.item().shape_size();
+    int height = shape_size.height();
+    _line_rows = int8_t(height / 8);
+    BN_ASSERT(height <= max_line_rows * 8, "Invalid font height: ", height);
+
+    regular_bg_tiles_ptr tiles = _map.tiles();
+    _tiles_vram = tiles.vram()->data();
+    _map_vram = _map.vram()->data();
+    _tiles_offset = int16_t(_map.tiles_offset());
+
+    regular_bg_map_cell_info empty_cell_info;
+    empty_cell_info.set_tile_index(_tiles_offset);
+    empty_cell_info.set_palette_id(_map.palette_banks_offset());
+    _empty_cell = empty_cell_info.cell();
+
+    hw::sprite_tiles::clear_tiles(1, _tiles_vram);
+
+    for(int index = tiles_count - 1; index > 0; --index)
+    {
+        _free_tiles.push_back(uint16_t(index));
+        _tile_hashes[index] = 0;
+        _tile_usages[index] = 0;
+    }
+
+    for(regular_bg_map_cell& cell : _cells)
+    {
+        cell = _empty_cell;
+    }
+
+    for(int index = 0; index < columns * rows; ++index)
+    {
+        _map_vram[index] = _empty_cell;
+    }
+}
+
+int bg_text_generator::width(const string_view& text) const
+{
+    return _for_each_character(_font, text, [](int, int, int)
+    {
+    });
+}
+
+void bg_text_generator::print(int x, int row, const string_view& text)
+{
+    int line_rows = _line_rows;
+    BN_ASSERT(row >= 0 && row + line_rows <= rows, "Invalid row: ", row);
+
+    switch(_alignment)
+    {
+
+    case alignment_type::LEFT:
+        break;
+
+    case alignment_type::CENTER:
+        x -= width(text) / 2;
+        break;
+
+    case alignment_type::RIGHT:
+        x -= width(text);
+        break;
+
+    default:
+        BN_ERROR("Invalid alignment: ", int(_alignment));
+        break;
+    }
+
+    const sprite_shape_size& shape_size = _font.item().shape_size();
+    int width_tiles = shape_size.width() / 8;
+    int graphics_tiles = width_tiles * line_rows;
+    bool fixed_width = _font.character_widths_ref().empty();
+    const tile* font_tiles_data = _font.item().tiles_item().tiles_ref().data();
+    regular_bg_map_cell new_cells[columns * max_line_rows];
+    tile band[band_tiles];
+    _last_updated_tiles_count = 0;
+
+    // Old cells are released first, so reprinting a line doesn't need twice its tiles:
+    _release_rows(row);
+
+    for(int line_row = 0; line_row < line_rows; ++line_row)
+    {
+        hw::sprite_tiles::clear_tiles(band_tiles, band);
+
+        _for_each_character(_font, text, [&](int graphics_index, int character_x, int character_width)
+        {
+            int left = x + character_x;
+
+            if(left >= 0 && left < map_width)
+            {
+                const tile* source_tiles_data = font_tiles_data + (graphics_index * graphics_tiles) +
+                        (line_row * width_tiles);
+
+                for(int tile_index = 0; tile_index < width_tiles; ++tile_index)
+                {
+                    int tile_width = fixed_width ? 8 : min(character_width - (tile_index * 8), 8);
+                    int tile_x = left + (tile_index * 8);
+
+                    if(tile_width <= 0 || tile_x >= map_width)
+                    {
+                        break;
+                    }
+
+                    hw::sprite_tiles::plot_tiles(tile_width, source_tiles_data + tile_index, 0, tile_x, band);
+                }
+            }
+        });
+
+        regular_bg_map_cell* new_cells_row = new_cells + (line_row * columns);
+
+        for(int column = 0; column < columns; ++column)
+        {
+            const tile& band_tile = band[column];
+            new_cells_row[column] = _empty_tile(band_tile) ? _empty_cell : _acquire_tile(band_tile);
+        }
+    }
+
+    _commit_rows(row, new_cells);
+}
+
+void bg_text_generator::clear(int row)
+{
+    BN_ASSERT(row >= 0 && row + _line_rows <= rows, "Invalid row: ", row);
+
+    regular_bg_map_cell new_cells[columns * max_line_rows];
+    _last_updated_tiles_count = 0;
+    _release_rows(row);
+
+    for(regular_bg_map_cell& cell : new_cells)
+    {
+        cell = _empty_cell;
+    }
+
+    _commit_rows(row, new_cells);
+}
+
+void bg_text_generator::clear()
+{
+    int updated_rows_count = 0;
+
+    for(int row = 0, line_rows = _line_rows; row <= rows - line_rows; row += line_rows)
+    {
+        clear(row);
+        updated_rows_count += _last_updated_rows_count;
+    }
+
+    if(rows % _line_rows)
+    {
+        clear(rows - _line_rows);
+        updated_rows_count += _last_updated_rows_count;
+    }
+
+    _last_updated_rows_count = updated_rows_count;
+}
+
+regular_bg_map_cell bg_text_generator::_acquire_tile(const tile& tile_data)
+{
+    unsigned hash = _tile_hash(tile_data);
+    auto tiles_map_it = _tiles_map.find(hash);
+
+    if(tiles_map_it != _tiles_map.end())
+    {
+        int tile_index = tiles_map_it->second;
+
+        if(_equal_tiles(_tiles_vram[tile_index], tile_data))
+        {
+            uint16_t& tile_usages = _tile_usages[tile_index];
+
+            if(! tile_usages)
+            {
+                // Released tiles keep their contents until they are reused, so they can be taken back:
+                auto free_tiles_it = find(_free_tiles.begin(), _free_tiles.end(), uint16_t(tile_index));
+                *free_tiles_it = _free_tiles.back();
+                _free_tiles.pop_back();
+            }
+
+            ++tile_usages;
+            return regular_bg_map_cell(_empty_cell + tile_index);
+        }
+    }
+
+    BN_BASIC_ASSERT(! _free_tiles.empty(), "No more tiles available");
+
+    int tile_index = _free_tiles.back();
+    _free_tiles.pop_back();
+
+    // The tiles map could still reference the previous contents of the reused tile:
+    auto old_tiles_map_it = _tiles_map.find(_tile_hashes[tile_index]);
+
+    if(old_tiles_map_it != _tiles_map.end() && old_tiles_map_it->second == tile_index)
+    {
+        _tiles_map.erase(old_tiles_map_it);
+    }
+
+    _tile_hashes[tile_index] = hash;
+    _tile_usages[tile_index] = 1;
+    hw::sprite_tiles::copy_tiles(&tile_data, 1, _tiles_vram + tile_index);
+    ++_last_updated_tiles_count;
+
+    if(_tiles_map.find(hash) == _tiles_map.end())
+    {
+        _tiles_map.insert(hash, uint16_t(tile_index));
+    }
+
+    return regular_bg_map_cell(_empty_cell + tile_index);
+}
+
+void bg_text_generator::_release_rows(int row)
+{
+    regular_bg_map_cell* cells = _cells + (row * columns);
+
+    for(int index = 0, limit = _line_rows * columns; index < limit; ++index)
+    {
+        if(int tile_index = cells[index] - _empty_cell)
+        {
+            uint16_t& tile_usages = _tile_usages[tile_index];
+            --tile_usages;
+
+            if(! tile_usages)
+            {
+                _free_tiles.push_back(uint16_t(tile_index));
+            }
+        }
+    }
+}
+
+void bg_text_generator::_commit_rows(int row, const regular_bg_map_cell* new_cells)
+{
+    int updated_rows_count = 0;
+
+    for(int line_row = 0, line_rows = _line_rows; line_row < line_rows; ++line_row)
+    {
+        int first_cell_index = (row + line_row) * columns;
+        regular_bg_map_cell* cells_row = _cells + first_cell_index;
+        const regular_bg_map_cell* new_cells_row = new_cells + (line_row * columns);
+        bool updated = false;
+
+        for(int column = 0; column < columns; ++column)
+        {
+            regular_bg_map_cell new_cell = new_cells_row[column];
+
+            if(cells_row[column] != new_cell)
+            {
+                cells_row[column] = new_cell;
+                updated = true;
+            }
+        }
+
+        if(updated)
+        {
+            regular_bg_map_cell* map_vram_row = _map_vram + first_cell_index;
+
+            for(int column = 0; column < columns; ++column)
+            {
+                map_vram_row[column] = cells_row[column];
+            }
+
+            ++updated_rows_count;
+        }
+    }
+
+    _last_updated_rows_count = updated_rows_count;
+}
+
+}
@@ -11,6 +11,7 @@
 #include "bn_display.h"
 #include "bn_sort_key.h"
 #include "bn_config_bgs.h"
+#include "bn_cameras_manager.h"
 #include "bn_display_manager.h"
 #include "bn_bg_blocks_manager.h"
 #include "bn_affine_bg_mat_attributes.h"
@@ -39,6 +40,7 @@ namespace
     {
 
     public:
+        camera_attach_node_type camera_attach_node;
         fixed_point position;
         affine_bg_mat_attributes affine_mat_attributes;
         point hw_position;
@@ -79,6 +81,7 @@ namespace
 
             hw::bgs::setup_regular(builder, hw_cnt);
             update_regular_map();
+            attach_camera();
         }
 
         item_type(affine_bg_builder&& builder, affine_bg_map_ptr&& _affine_map) :
@@ -100,6 +103,28 @@ namespace
             hw::bgs::setup_affine(builder, hw_cnt);
 
             [[maybe_unused]] bool affine_mat_attributes_updated = update_affine_map(true);
+            attach_camera();
+        }
+
+        [[nodiscard]] static item_type& camera_attach_node_item(camera_attach_node_type& attach_node)
+        {
+            return *reinterpret_cast<item_type*>(&attach_node);
+        }
+
+        void attach_camera()
+        {
+            if(const camera_ptr* camera_ptr = camera.get())
+            {
+                cameras_manager::attach_bg(camera_ptr->id(), camera_attach_node);
+            }
+        }
+
+        void dettach_camera()
+        {
+            if(const camera_ptr* camera_ptr = camera.get())
+            {
+                cameras_manager::dettach_bg(camera_ptr->id(), camera_attach_node);
+            }
         }
 
         void update_regular_map()
@@ -549,6 +574,7 @@ void decrease_usages(id_type id)
             data.rebuild_handles = true;
         }
 
+        item->dettach_camera();
         erase(data.items_vector, item);
         data.items_pool.destroy(*item);
     }
@@ -1387,7 +1413,9 @@ void set_camera(id_type id, camera_ptr&& camera)
 
     if(camera != item->camera)
     {
+        item->dettach_camera();
         item->camera = move(camera);
+        item->attach_camera();
 
         if(item->regular_map)
         {
@@ -1408,6 +1436,7 @@ void remove_camera(id_type id)
 
     if(item->camera)
     {
+        item->dettach_camera();
         item->camera.reset();
 
         if(item->regular_map)
@@ -1423,22 +1452,21 @@ void remove_camera(id_type id)
     }
 }
 
-void update_cameras()
+void update_camera(intrusive_list<camera_attach_node_type>& attached_nodes)
 {
-    for(item_type* item : data.items_vector)
+    for(camera_attach_node_type& attached_node : attached_nodes)
     {
-        if(item->camera)
+        item_type& item = item_type::camera_attach_node_item(attached_node);
+
+        if(item.regular_map)
         {
-            if(item->regular_map)
-            {
-                item->update_regular_hw_position();
-                _update_item_hw_regular_offset(*item);
-            }
-            else
-            {
-                item->update_affine_camera();
-                _update_item_hw_affine_attributes(*item);
-            }
+            item.update_regular_hw_position();
+            _update_item_hw_regular_offset(item);
+        }
+        else
+        {
+            item.update_affine_camera();
+            _update_item_hw_affine_attributes(item);
         }
     }
 }
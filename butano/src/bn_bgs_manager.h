@@ -9,6 +9,7 @@
 #include "bn_fixed_fwd.h"
 #include "bn_optional_fwd.h"
 #include "bn_fixed_point_fwd.h"
+#include "bn_intrusive_list_fwd.h"
 
 namespace bn
 {
@@ -26,6 +27,8 @@ class affine_mat_attributes;
 class affine_bg_mat_attributes;
 enum class bpp_mode : uint8_t;
 
+using camera_attach_node_type = intrusive_list_node_type;
+
 namespace bgs_manager
 {
     using id_type = void*;
@@ -188,7 +191,7 @@ namespace bgs_manager
 
     void remove_camera(id_type id);
 
-    void update_cameras();
+    void update_camera(intrusive_list<camera_attach_node_type>& attached_nodes);
 
     void update_regular_map_tiles_cbb(int map_id, int tiles_cbb);
 
@@ -29,7 +29,10 @@ namespace
 
     public:
         fixed_point position;
+        intrusive_list<camera_attach_node_type> attached_sprites;
+        intrusive_list<camera_attach_node_type> attached_bgs;
         unsigned usages = 0;
+        bool update = false;
     };
 
 
@@ -44,6 +47,13 @@ namespace
     };
 
     BN_DATA_EWRAM_BSS static_data data;
+
+
+    void _update(item_type& item)
+    {
+        item.update = true;
+        data.update = true;
+    }
 }
 
 void init()
@@ -126,7 +136,7 @@ void set_x(int id, fixed x)
     if(item.position.x() != x)
     {
         item.position.set_x(x);
-        data.update = true;
+        _update(item);
     }
 }
 
@@ -137,7 +147,7 @@ void set_y(int id, fixed y)
     if(item.position.y() != y)
     {
         item.position.set_y(y);
-        data.update = true;
+        _update(item);
     }
 }
 
@@ -148,10 +158,34 @@ void set_position(int id, const fixed_point& position)
     if(item.position != position)
     {
         item.position = position;
-        data.update = true;
+        _update(item);
     }
 }
 
+void attach_sprite(int id, camera_attach_node_type& attach_node)
+{
+    item_type& item = data.items[id];
+    item.attached_sprites.push_back(attach_node);
+}
+
+void dettach_sprite(int id, camera_attach_node_type& attach_node)
+{
+    item_type& item = data.items[id];
+    item.attached_sprites.erase(attach_node);
+}
+
+void attach_bg(int id, camera_attach_node_type& attach_node)
+{
+    item_type& item = data.items[id];
+    item.attached_bgs.push_back(attach_node);
+}
+
+void dettach_bg(int id, camera_attach_node_type& attach_node)
+{
+    item_type& item = data.items[id];
+    item.attached_bgs.erase(attach_node);
+}
+
 void update()
 {
     if(data.update)
@@ -159,8 +193,25 @@ void update()
         data.update = false;
 
         display_manager::update_cameras();
-        sprites_manager::update_cameras();
-        bgs_manager::update_cameras();
+
+        // Only the sprites and backgrounds attached to the moved cameras are updated:
+        for(item_type& item : data.items)
+        {
+            if(item.update)
+            {
+                item.update = false;
+
+                if(! item.attached_sprites.empty())
+                {
+                    sprites_manager::update_camera(item.attached_sprites);
+                }
+
+                if(! item.attached_bgs.empty())
+                {
+                    bgs_manager::update_camera(item.attached_bgs);
+                }
+            }
+        }
     }
 }
 
@@ -7,8 +7,14 @@
 #define BN_CAMERAS_MANAGER_H
 
 #include "bn_fixed_fwd.h"
+#include "bn_intrusive_list.h"
 #include "bn_fixed_point_fwd.h"
 
+namespace bn
+{
+    using camera_attach_node_type = intrusive_list_node_type;
+}
+
 namespace bn::cameras_manager
 {
     void init();
@@ -33,6 +39,14 @@ namespace bn::cameras_manager
 
     void set_position(int id, const fixed_point& position);
 
+    void attach_sprite(int id, camera_attach_node_type& attach_node);
+
+    void dettach_sprite(int id, camera_attach_node_type& attach_node);
+
+    void attach_bg(int id, camera_attach_node_type& attach_node);
+
+    void dettach_bg(int id, camera_attach_node_type& attach_node);
+
     void update();
 }
 
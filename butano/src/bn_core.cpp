@@ -18,6 +18,7 @@
 #include "bn_hdma_manager.h"
 #include "bn_link_manager.h"
 #include "bn_gpio_manager.h"
+#include "bn_config_keypad.h"
 #include "bn_audio_manager.h"
 #include "bn_keypad_manager.h"
 #include "bn_memory_manager.h"
@@ -26,7 +27,9 @@
 #include "bn_cameras_manager.h"
 #include "bn_palettes_manager.h"
 #include "bn_bg_blocks_manager.h"
+#include "bn_frame_arena_manager.h"
 #include "bn_sprite_tiles_manager.h"
+#include "bn_sprite_animations_manager.h"
 #include "bn_hblank_effects_manager.h"
 #include "../hw/include/bn_hw_irq.h"
 #include "../hw/include/bn_hw_core.h"
@@ -135,6 +138,9 @@ namespace
         int skip_frames = 0;
         int last_update_frames = 1;
         int missed_frames = 0;
+        #if BN_CFG_PROFILER_ENABLED && BN_CFG_PROFILER_LOG_FRAMES > 0
+            int profiler_log_frames = BN_CFG_PROFILER_LOG_FRAMES;
+        #endif
         bool dma_enabled = true;
         bool slow_game_pak = false;
         volatile bool waiting_for_vblank = false;
@@ -188,12 +194,23 @@ namespace
         cameras_manager::update();
         BN_PROFILER_ENGINE_DETAILED_STOP();
 
+        BN_PROFILER_ENGINE_DETAILED_START("eng_spr_anims_update");
+        sprite_animations_manager::update();
+        BN_PROFILER_ENGINE_DETAILED_STOP();
+
         BN_PROFILER_ENGINE_DETAILED_START("eng_sprites_update");
         sprites_manager::update();
         BN_PROFILER_ENGINE_DETAILED_STOP();
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_spr_tiles_update");
         sprite_tiles_manager::update();
+
+        if(sprite_tiles_manager::compact())
+        {
+            sprites_manager::reload_tiles();
+            hblank_effects_manager::reload_sprite_tiles();
+        }
+
         BN_PROFILER_ENGINE_DETAILED_STOP();
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_bgs_update");
@@ -357,13 +374,15 @@ void init(const optional<color>& transparent_color, const string_view& keypad_co
 
     // Init high level systems:
     memory_manager::init();
+    frame_arena_manager::init();
     cameras_manager::init();
     palettes_manager::init(transparent_color);
     sprite_tiles_manager::init();
     sprites_manager::init();
+    sprite_animations_manager::init();
     bg_blocks_manager::init();
     bgs_manager::init();
-    keypad_manager::init(keypad_commands);
+    keypad_manager::init(keypad_commands.empty() ? string_view(BN_CFG_KEYPAD_COMMANDS) : keypad_commands);
 
     // First update:
     update();
@@ -394,6 +413,8 @@ void set_skip_frames(int skip_frames)
 
 void update()
 {
+    frame_arena_manager::reset();
+
     int update_frames = data.skip_frames + 1;
     data.last_update_frames = update_frames;
 
@@ -421,6 +442,18 @@ void update()
     BN_PROFILER_ENGINE_DETAILED_START("eng_keypad");
     keypad_manager::update();
     BN_PROFILER_ENGINE_DETAILED_STOP();
+
+    #if BN_CFG_PROFILER_ENABLED && BN_CFG_PROFILER_LOG_FRAMES > 0
+        if(data.profiler_log_frames)
+        {
+            --data.profiler_log_frames;
+
+            if(! data.profiler_log_frames)
+            {
+                profiler::log();
+            }
+        }
+    #endif
 }
 
 void on_vblank()
@@ -715,6 +748,7 @@ void set_dma_enabled(bool dma_enabled)
     {
         void show()
         {
+            log();
             core::stop(false);
             hw::show::profiler_results(core::system_font());
         }
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_frame_arena.h"
+
+#include "bn_frame_arena_manager.h"
+
+namespace bn::frame_arena
+{
+
+void* iwram_alloc(int bytes, int alignment)
+{
+    return frame_arena_manager::iwram_alloc(bytes, alignment);
+}
+
+void* ewram_alloc(int bytes, int alignment)
+{
+    return frame_arena_manager::ewram_alloc(bytes, alignment);
+}
+
+int used_iwram()
+{
+    return frame_arena_manager::used_iwram();
+}
+
+int available_iwram()
+{
+    return frame_arena_manager::available_iwram();
+}
+
+int max_used_iwram()
+{
+    return frame_arena_manager::max_used_iwram();
+}
+
+int used_ewram()
+{
+    return frame_arena_manager::used_ewram();
+}
+
+int available_ewram()
+{
+    return frame_arena_manager::available_ewram();
+}
+
+int max_used_ewram()
+{
+    return frame_arena_manager::max_used_ewram();
+}
+
+void reset()
+{
+    frame_arena_manager::reset();
+}
+
+void reset_max_used()
+{
+    frame_arena_manager::reset_max_used();
+}
+
+void log_status()
+{
+    #if BN_CFG_LOG_ENABLED
+        frame_arena_manager::log_status();
+    #endif
+}
+
+}
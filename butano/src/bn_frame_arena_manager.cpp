@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_frame_arena_manager.h"
+
+#include "bn_assert.h"
+#include "bn_power_of_two.h"
+#include "bn_config_frame_arena.h"
+
+#if BN_CFG_LOG_ENABLED
+    #include "bn_log.h"
+#endif
+
+#include "bn_frame_arena.cpp.h"
+
+namespace bn::frame_arena_manager
+{
+
+namespace
+{
+    static_assert(BN_CFG_FRAME_ARENA_IWRAM_BYTES >= 0 && BN_CFG_FRAME_ARENA_IWRAM_BYTES % 4 == 0);
+    static_assert(BN_CFG_FRAME_ARENA_EWRAM_BYTES >= 0 && BN_CFG_FRAME_ARENA_EWRAM_BYTES % 4 == 0);
+
+    constexpr int iwram_buffer_size = BN_CFG_FRAME_ARENA_IWRAM_BYTES ? BN_CFG_FRAME_ARENA_IWRAM_BYTES : 4;
+    constexpr int ewram_buffer_size = BN_CFG_FRAME_ARENA_EWRAM_BYTES ? BN_CFG_FRAME_ARENA_EWRAM_BYTES : 4;
+
+    class arena
+    {
+
+    public:
+        uint8_t* buffer = nullptr;
+        int capacity = 0;
+        int used = 0;
+        int max_used = 0;
+
+        [[nodiscard]] void* alloc(int bytes, int alignment)
+        {
+            BN_ASSERT(bytes >= 0, "Invalid bytes: ", bytes);
+            BN_ASSERT(alignment > 0 && power_of_two(alignment), "Invalid alignment: ", alignment);
+
+            uintptr_t buffer_address = uintptr_t(buffer);
+            uintptr_t start_address = buffer_address + unsigned(used);
+            uintptr_t alignment_mask = uintptr_t(alignment) - 1;
+            start_address = (start_address + alignment_mask) & ~alignment_mask;
+
+            int start = int(start_address - buffer_address);
+            int end = start + bytes;
+            BN_BASIC_ASSERT(end <= capacity, "Frame arena overflow: ", bytes, " - ", capacity - used);
+
+            used = end;
+
+            if(end > max_used)
+            {
+                max_used = end;
+            }
+
+            return buffer + start;
+        }
+
+        [[nodiscard]] int available() const
+        {
+            return capacity - used;
+        }
+    };
+
+    class static_data
+    {
+
+    public:
+        arena iwram_arena;
+        arena ewram_arena;
+    };
+
+    alignas(4) uint8_t iwram_buffer[iwram_buffer_size];
+
+    alignas(4) BN_DATA_EWRAM_BSS uint8_t ewram_buffer[ewram_buffer_size];
+
+    BN_DATA_EWRAM_BSS static_data data;
+}
+
+void init()
+{
+    new(&data) static_data();
+
+    data.iwram_arena.buffer = iwram_buffer;
+    data.iwram_arena.capacity = BN_CFG_FRAME_ARENA_IWRAM_BYTES;
+    data.ewram_arena.buffer = ewram_buffer;
+    data.ewram_arena.capacity = BN_CFG_FRAME_ARENA_EWRAM_BYTES;
+}
+
+void* iwram_alloc(int bytes, int alignment)
+{
+    return data.iwram_arena.alloc(bytes, alignment);
+}
+
+void* ewram_alloc(int bytes, int alignment)
+{
+    return data.ewram_arena.alloc(bytes, alignment);
+}
+
+int used_iwram()
+{
+    return data.iwram_arena.used;
+}
+
+int available_iwram()
+{
+    return data.iwram_arena.available();
+}
+
+int max_used_iwram()
+{
+    return data.iwram_arena.max_used;
+}
+
+int used_ewram()
+{
+    return data.ewram_arena.used;
+}
+
+int available_ewram()
+{
+    return data.ewram_arena.available();
+}
+
+int max_used_ewram()
+{
+    return data.ewram_arena.max_used;
+}
+
+void reset()
+{
+    data.iwram_arena.used = 0;
+    data.ewram_arena.used = 0;
+}
+
+void reset_max_used()
+{
+    data.iwram_arena.max_used = data.iwram_arena.used;
+    data.ewram_arena.max_used = data.ewram_arena.used;
+}
+
+#if BN_CFG_LOG_ENABLED
+    void log_status()
+    {
+        BN_LOG("iwram used: ", data.iwram_arena.used);
+        BN_LOG("iwram max used: ", data.iwram_arena.max_used);
+        BN_LOG("iwram capacity: ", data.iwram_arena.capacity);
+        BN_LOG("ewram used: ", data.ewram_arena.used);
+        BN_LOG("ewram max used: ", data.ewram_arena.max_used);
+        BN_LOG("ewram capacity: ", data.ewram_arena.capacity);
+    }
+#endif
+
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_FRAME_ARENA_MANAGER_H
+#define BN_FRAME_ARENA_MANAGER_H
+
+#include "bn_config_log.h"
+
+namespace bn::frame_arena_manager
+{
+    void init();
+
+    [[nodiscard]] void* iwram_alloc(int bytes, int alignment);
+
+    [[nodiscard]] void* ewram_alloc(int bytes, int alignment);
+
+    [[nodiscard]] int used_iwram();
+
+    [[nodiscard]] int available_iwram();
+
+    [[nodiscard]] int max_used_iwram();
+
+    [[nodiscard]] int used_ewram();
+
+    [[nodiscard]] int available_ewram();
+
+    [[nodiscard]] int max_used_ewram();
+
+    void reset();
+
+    void reset_max_used();
+
+    #if BN_CFG_LOG_ENABLED
+        void log_status();
+    #endif
+}
+
+#endif
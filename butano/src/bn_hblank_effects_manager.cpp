@@ -1276,6 +1276,22 @@ void reload_values_ref(int id)
     }
 }
 
+void reload_sprite_tiles()
+{
+    for(item_type& item : external_data.items)
+    {
+        if(item.usages && item.handler == handler_type::SPRITE_THIRD_ATTRIBUTES)
+        {
+            item.update = true;
+
+            if(item.visible)
+            {
+                external_data.update = true;
+            }
+        }
+    }
+}
+
 [[nodiscard]] bool visible(int id)
 {
     const item_type& item = external_data.items[id];
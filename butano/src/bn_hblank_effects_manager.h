@@ -80,6 +80,8 @@ namespace bn::hblank_effects_manager
 
     void reload_values_ref(int id);
 
+    void reload_sprite_tiles();
+
     [[nodiscard]] bool visible(int id);
 
     void set_visible(int id, bool visible);
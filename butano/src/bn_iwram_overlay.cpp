@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_iwram_overlay.h"
+
+#include "bn_timer.h"
+#include "bn_optional.h"
+#include "../hw/include/bn_hw_iwram_overlays.h"
+
+namespace bn::iwram_overlay
+{
+
+namespace
+{
+    class static_data
+    {
+
+    public:
+        optional<int> loaded_id;
+        int last_load_ticks = 0;
+    };
+
+    BN_DATA_EWRAM static_data data;
+
+    void _check_id([[maybe_unused]] int id)
+    {
+        BN_ASSERT(id >= 0 && id < hw::iwram_overlays::count(), "Invalid id: ", id);
+    }
+}
+
+bool supported()
+{
+    return hw::iwram_overlays::supported();
+}
+
+int count()
+{
+    return hw::iwram_overlays::count();
+}
+
+int bytes(int id)
+{
+    _check_id(id);
+
+    const unsigned* start;
+    const unsigned* end;
+    hw::iwram_overlays::rom_range(id, start, end);
+
+    auto start_bytes = reinterpret_cast<const uint8_t*>(start);
+    auto end_bytes = reinterpret_cast<const uint8_t*>(end);
+    return end_bytes - start_bytes;
+}
+
+int max_bytes()
+{
+    return hw::iwram_overlays::region_bytes();
+}
+
+const optional<int>& loaded_id()
+{
+    return data.loaded_id;
+}
+
+bool loaded(int id)
+{
+    _check_id(id);
+
+    return data.loaded_id == id;
+}
+
+void load(int id)
+{
+    _check_id(id);
+    BN_BASIC_ASSERT(supported(), "IWRAM overlays are not supported by the current toolchain");
+
+    if(data.loaded_id != id)
+    {
+        timer load_timer;
+        const unsigned* start;
+        const unsigned* end;
+        hw::iwram_overlays::rom_range(id, start, end);
+
+        if(int words = end - start)
+        {
+            hw::iwram_overlays::load(start, words);
+        }
+
+        data.loaded_id = id;
+        data.last_load_ticks = load_timer.elapsed_ticks();
+    }
+}
+
+void unload()
+{
+    data.loaded_id.reset();
+}
+
+int last_load_ticks()
+{
+    return data.last_load_ticks;
+}
+
+}
@@ -5,6 +5,7 @@
 
 #include "bn_link_manager.h"
 
+#include "bn_sampling_profiler.h"
 #include "../hw/include/bn_hw_link.h"
 
 #include "bn_link.cpp.h"
@@ -12,6 +13,17 @@
 namespace bn::link_manager
 {
 
+namespace
+{
+    void _check_sampling_profiler()
+    {
+        #if BN_CFG_SAMPLING_PROFILER_ENABLED
+            BN_BASIC_ASSERT(! sampling_profiler::running(),
+                            "Link communication can't be used while the sampling profiler is running");
+        #endif
+    }
+}
+
 void init()
 {
     hw::link::init();
@@ -24,11 +36,14 @@ bool active()
 
 void send(int data_to_send)
 {
+    _check_sampling_profiler();
     hw::link::send(data_to_send + 1);
 }
 
 optional<link_state> receive()
 {
+    _check_sampling_profiler();
+
     lc::LinkResponse response;
     optional<link_state> result;
 
@@ -30,18 +30,22 @@ namespace
     }
 }
 
-uint16_t palettes_bank::colors_hash(const span<const color>& colors)
+unsigned palettes_bank::colors_hash(const span<const color>& colors)
 {
     const color* colors_data = colors.data();
     BN_ASSERT(aligned<4>(colors_data), "Colors are not aligned");
 
+    // FNV-1a, the same hash calculated by the assets conversion tools:
     auto u32_colors = reinterpret_cast<const unsigned*>(colors_data);
-    auto result = u32_colors[0] + u32_colors[1] + u32_colors[2];
+    unsigned result = 2166136261U;
 
-    // Active palettes hash > 0:
-    result |= unsigned(colors.size());
+    for(int index = 0, limit = colors.size() / 2; index < limit; ++index)
+    {
+        result = (result ^ u32_colors[index]) * 16777619U;
+    }
 
-    return uint16_t(result);
+    // Active palettes hash > 0:
+    return result ? result : 1;
 }
 
 int palettes_bank::used_colors_count() const
@@ -78,38 +82,45 @@ int palettes_bank::used_colors_count() const
         }
 
         BN_LOG(']');
+        BN_LOG("reused palettes: ", _reused_palettes_count, " - created palettes: ", _created_palettes_count);
     }
 #endif
 
-int palettes_bank::find_bpp_4(const span<const color>& colors, uint16_t hash)
+int palettes_bank::find_bpp_4(const span<const color>& colors, unsigned hash)
 {
     auto bpp_4_indexes_map_it = _bpp_4_indexes_map.find(hash);
 
-    if(bpp_4_indexes_map_it != _bpp_4_indexes_map.end())
+    if(bpp_4_indexes_map_it == _bpp_4_indexes_map.end())
     {
-        int index = bpp_4_indexes_map_it->second;
-
-        if(_same_colors(colors, index))
-        {
-            palette& pal = _palettes[index];
-            ++pal.usages;
-            return index;
-        }
+        return -1;
     }
 
-    for(int index = hw::palettes::count() - 1, limit = _bpp_8_slots_count(); index >= limit; --index)
+    int index = bpp_4_indexes_map_it->second;
+
+    if(! _same_colors(colors, index)) [[unlikely]]
     {
-        palette& pal = _palettes[index];
+        // Hash collision:
+        index = -1;
 
-        // Active palettes hash > 0:
-        if(hash == pal.hash && _same_colors(colors, index))
+        for(int other_index = hw::palettes::count() - 1, limit = _bpp_8_slots_count(); other_index >= limit;
+            --other_index)
         {
-            ++pal.usages;
-            return index;
+            if(_palettes[other_index].hash == hash && _same_colors(colors, other_index))
+            {
+                index = other_index;
+                break;
+            }
+        }
+
+        if(index < 0)
+        {
+            return -1;
         }
     }
 
-    return -1;
+    ++_palettes[index].usages;
+    ++_reused_palettes_count;
+    return index;
 }
 
 int palettes_bank::find_bpp_8(const span<const color>& colors)
@@ -126,7 +137,7 @@ int palettes_bank::find_bpp_8(const span<const color>& colors)
     return -1;
 }
 
-int palettes_bank::create_bpp_4(const span<const color>& colors, uint16_t hash, bool required)
+int palettes_bank::create_bpp_4(const span<const color>& colors, unsigned hash, bool required)
 {
     int colors_count = colors.size();
     int required_slots_count = colors_count / hw::palettes::colors_per_palette();
@@ -157,7 +168,8 @@ int palettes_bank::create_bpp_4(const span<const color>& colors, uint16_t hash,
                 }
 
                 _set_colors_bpp_impl(index, colors);
-                _bpp_4_indexes_map.insert_or_assign(hash, int16_t(index));
+                _bpp_4_indexes_map.insert(hash, int16_t(index));
+                ++_created_palettes_count;
                 return index;
             }
         }
@@ -288,12 +300,14 @@ void palettes_bank::decrease_usages(int id)
             _palettes[id + slot].locked = false;
         }
 
-        if(! pal.bpp_8)
+        unsigned hash = pal.hash;
+        bool bpp_8 = pal.bpp_8;
+        pal = palette();
+
+        if(! bpp_8)
         {
-            _bpp_4_indexes_map.erase(pal.hash);
+            _remove_bpp_4_index(hash, id);
         }
-
-        pal = palette();
     }
 }
 
@@ -330,14 +344,14 @@ void palettes_bank::set_colors(int id, const span<const color>& colors)
     }
     else
     {
-        uint16_t old_hash = pal.hash;
-        uint16_t new_hash = colors_hash(colors);
+        unsigned old_hash = pal.hash;
+        unsigned new_hash = colors_hash(colors);
 
         if(old_hash != new_hash)
         {
-            _bpp_4_indexes_map.erase(old_hash);
-            _bpp_4_indexes_map.insert_or_assign(new_hash, int16_t(id));
             pal.hash = new_hash;
+            _remove_bpp_4_index(old_hash, id);
+            _bpp_4_indexes_map.insert(new_hash, int16_t(id));
         }
     }
 
@@ -608,6 +622,12 @@ void palettes_bank::update()
     if(_update)
     {
         bool update_global_effects = _update_global_effects || _global_effects_enabled;
+
+        if(_update_global_effects && _global_effects_enabled)
+        {
+            _update_global_effects_luts();
+        }
+
         _update = false;
         _global_effects_updated = _update_global_effects;
         _update_global_effects = false;
@@ -777,6 +797,28 @@ void palettes_bank::_on_global_effect_updated(bool active)
             fixed_t<5>(_fade_intensity).data();
 }
 
+void palettes_bank::_remove_bpp_4_index(unsigned hash, int id)
+{
+    auto bpp_4_indexes_map_it = _bpp_4_indexes_map.find(hash);
+
+    if(bpp_4_indexes_map_it != _bpp_4_indexes_map.end() && bpp_4_indexes_map_it->second == id)
+    {
+        _bpp_4_indexes_map.erase(bpp_4_indexes_map_it);
+
+        // Keep another palette with the same hash findable:
+        for(int index = hw::palettes::count() - 1, limit = _bpp_8_slots_count(); index >= limit; --index)
+        {
+            const palette& pal = _palettes[index];
+
+            if(pal.hash == hash && pal.usages)
+            {
+                _bpp_4_indexes_map.insert(hash, int16_t(index));
+                break;
+            }
+        }
+    }
+}
+
 void palettes_bank::_set_colors_bpp_impl(int id, const span<const color>& colors)
 {
     palette& pal = _palettes[id];
@@ -823,42 +865,17 @@ void palettes_bank::_update_palette(int id)
     }
 }
 
-void palettes_bank::_apply_global_effects(int dest_colors_count, color* dest_colors_ptr) const
+void palettes_bank::_update_global_effects_luts()
 {
-    if(int brightness = fixed_t<5>(_brightness).data())
-    {
-        hw::palettes::brightness(dest_colors_ptr, brightness, dest_colors_count, dest_colors_ptr);
-    }
-
-    if(int contrast = fixed_t<5>(_contrast).data())
-    {
-        hw::palettes::contrast(dest_colors_ptr, contrast, dest_colors_count, dest_colors_ptr);
-    }
-
-    if(int intensity = fixed_t<5>(_intensity).data())
-    {
-        hw::palettes::intensity(dest_colors_ptr, intensity, dest_colors_count, dest_colors_ptr);
-    }
-
-    if(int hue_shift_intensity = fixed_t<5>(_hue_shift_intensity).data())
-    {
-        hw::palettes::hue_shift(dest_colors_ptr, hue_shift_intensity, dest_colors_count, dest_colors_ptr);
-    }
-
-    if(_inverted)
-    {
-        hw::palettes::aligned_invert(dest_colors_ptr, dest_colors_count, dest_colors_ptr);
-    }
-
-    if(int grayscale_intensity = fixed_t<5>(_grayscale_intensity).data())
-    {
-        hw::palettes::grayscale(dest_colors_ptr, grayscale_intensity, dest_colors_count, dest_colors_ptr);
-    }
+    hw::palettes::build_effects_luts(
+                fixed_t<5>(_brightness).data(), fixed_t<5>(_contrast).data(), fixed_t<5>(_intensity).data(),
+                fixed_t<5>(_hue_shift_intensity).data(), _inverted, fixed_t<5>(_grayscale_intensity).data(),
+                _fade_color, fixed_t<5>(_fade_intensity).data(), _global_effects_luts);
+}
 
-    if(int fade_intensity = fixed_t<5>(_fade_intensity).data())
-    {
-        hw::palettes::fade(dest_colors_ptr, _fade_color, fade_intensity, dest_colors_count, dest_colors_ptr);
-    }
+void palettes_bank::_apply_global_effects(int dest_colors_count, color* dest_colors_ptr) const
+{
+    hw::palettes::apply_effects_luts(dest_colors_ptr, _global_effects_luts, dest_colors_count, dest_colors_ptr);
 }
 
 void palettes_bank::palette::apply_effects(int dest_colors_count, color* dest_colors_ptr) const
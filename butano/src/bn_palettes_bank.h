@@ -35,7 +35,12 @@ public:
         int count;
     };
 
-    [[nodiscard]] static uint16_t colors_hash(const span<const color>& colors);
+    [[nodiscard]] static unsigned colors_hash(const span<const color>& colors);
+
+    [[nodiscard]] static unsigned colors_hash(const span<const color>& colors, unsigned precalculated_hash)
+    {
+        return precalculated_hash ? precalculated_hash : colors_hash(colors);
+    }
 
     [[nodiscard]] int used_colors_count() const;
 
@@ -44,15 +49,25 @@ public:
         return hw::palettes::colors() - used_colors_count();
     }
 
+    [[nodiscard]] int reused_palettes_count() const
+    {
+        return _reused_palettes_count;
+    }
+
+    [[nodiscard]] int created_palettes_count() const
+    {
+        return _created_palettes_count;
+    }
+
     #if BN_CFG_LOG_ENABLED
         void log_status() const;
     #endif
 
-    [[nodiscard]] int find_bpp_4(const span<const color>& colors, uint16_t hash);
+    [[nodiscard]] int find_bpp_4(const span<const color>& colors, unsigned hash);
 
     [[nodiscard]] int find_bpp_8(const span<const color>& colors);
 
-    [[nodiscard]] int create_bpp_4(const span<const color>& colors, uint16_t hash, bool required);
+    [[nodiscard]] int create_bpp_4(const span<const color>& colors, unsigned hash, bool required);
 
     [[nodiscard]] int create_bpp_8(const span<const color>& colors, compression_type compression, bool required);
 
@@ -231,7 +246,7 @@ private:
         fixed hue_shift_intensity;
         fixed fade_intensity;
         color fade_color;
-        uint16_t hash = 0;
+        unsigned hash = 0;
         int16_t rotate_count = 0;
 
         int8_t slots_count = 1;
@@ -257,9 +272,12 @@ private:
     fixed _grayscale_intensity;
     fixed _hue_shift_intensity;
     fixed _fade_intensity;
-    unordered_map<uint16_t, int16_t, hw::palettes::count() * 2, identity_hasher> _bpp_4_indexes_map;
+    unordered_map<unsigned, int16_t, hw::palettes::count() * 2, identity_hasher> _bpp_4_indexes_map;
+    hw::palettes::effects_luts _global_effects_luts = {};
     int _first_index_to_commit = numeric_limits<int>::max();
     int _last_index_to_commit = 0;
+    int _reused_palettes_count = 0;
+    int _created_palettes_count = 0;
     color _fade_color;
     bool _inverted = false;
     bool _update = false;
@@ -275,10 +293,14 @@ private:
 
     void _on_global_effect_updated(bool active);
 
+    void _remove_bpp_4_index(unsigned hash, int id);
+
     void _set_colors_bpp_impl(int id, const span<const color>& colors);
 
     void _update_palette(int id);
 
+    void _update_global_effects_luts();
+
     void _apply_global_effects(int dest_colors_count, color* dest_colors_ptr) const;
 };
 
@@ -6,6 +6,7 @@
 #include "bn_profiler.h"
 
 #if BN_CFG_PROFILER_ENABLED
+    #include "bn_log.h"
     #include "bn_timer.h"
     #include "bn_optional.h"
     #include "bn_unordered_map.h"
@@ -66,4 +67,22 @@
             data.ticks_per_entry.clear();
         }
     }
+
+    namespace bn::profiler
+    {
+        void log()
+        {
+            #if BN_CFG_LOG_ENABLED
+                BN_LOG("profiler: begin");
+
+                for(const auto& ticks_per_entry_pair : _bn::profiler::ticks_per_entry())
+                {
+                    const _bn::profiler::ticks& ticks = ticks_per_entry_pair.second;
+                    BN_LOG("profiler: ", ticks_per_entry_pair.first, ' ', ticks.total, ' ', ticks.max);
+                }
+
+                BN_LOG("profiler: end");
+            #endif
+        }
+    }
 #endif
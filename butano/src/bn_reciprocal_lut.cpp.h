@@ -28,10 +28,23 @@ namespace
 
         return result;
     }();
+
+    alignas(int) constexpr array<uint16_t, reciprocal_seed_lut_size> reciprocal_seed_lut_impl = []{
+        array<uint16_t, reciprocal_seed_lut_size> result;
+
+        for(int index = 0; index < reciprocal_seed_lut_size; ++index)
+        {
+            result[index] = calculate_reciprocal_seed_lut_value(index);
+        }
+
+        return result;
+    }();
 }
 
 const array<fixed_t<20>, reciprocal_lut_size>& reciprocal_lut = reciprocal_lut_impl;
 
 alignas(int) const array<uint16_t, reciprocal_16_lut_size>& reciprocal_16_lut = reciprocal_16_lut_impl;
 
+alignas(int) const array<uint16_t, reciprocal_seed_lut_size>& reciprocal_seed_lut = reciprocal_seed_lut_impl;
+
 }
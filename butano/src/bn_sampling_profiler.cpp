@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_sampling_profiler.h"
+
+#if BN_CFG_SAMPLING_PROFILER_ENABLED
+    #include "bn_log.h"
+    #include "bn_memory.h"
+    #include "bn_link_manager.h"
+    #include "../hw/include/bn_hw_link.h"
+    #include "../hw/include/bn_hw_sampling_profiler.h"
+
+    namespace bn::sampling_profiler
+    {
+        namespace
+        {
+            class static_data
+            {
+
+            public:
+                int timer_ticks = 0;
+                bool running = false;
+                bool histogram_cleared = false;
+            };
+
+            BN_DATA_EWRAM static_data data;
+        }
+
+        void start(int samples_per_second)
+        {
+            BN_ASSERT(samples_per_second >= 4 && samples_per_second <= 16384,
+                      "Invalid samples per second: ", samples_per_second);
+            BN_BASIC_ASSERT(! data.running, "Sampling profiler is already running");
+            BN_BASIC_ASSERT(! link_manager::active(), "Link communication is active");
+
+            if(! data.histogram_cleared)
+            {
+                memory::clear(1, hw::sampling_profiler::data());
+                data.histogram_cleared = true;
+            }
+
+            data.timer_ticks = hw::sampling_profiler::ticks_per_second() / samples_per_second;
+            hw::sampling_profiler::start(data.timer_ticks);
+            data.running = true;
+        }
+
+        void stop()
+        {
+            if(data.running)
+            {
+                hw::sampling_profiler::stop();
+                hw::link::restore_timer_isr();
+                data.running = false;
+            }
+        }
+
+        bool running()
+        {
+            return data.running;
+        }
+
+        int samples_count()
+        {
+            return data.histogram_cleared ? hw::sampling_profiler::data().samples_count : 0;
+        }
+
+        int lost_samples_count()
+        {
+            return data.histogram_cleared ? hw::sampling_profiler::data().lost_samples_count : 0;
+        }
+
+        void reset()
+        {
+            if(data.running)
+            {
+                hw::sampling_profiler::stop();
+            }
+
+            memory::clear(1, hw::sampling_profiler::data());
+            data.histogram_cleared = true;
+
+            if(data.running)
+            {
+                hw::sampling_profiler::start(data.timer_ticks);
+            }
+        }
+
+        void log()
+        {
+            #if BN_CFG_LOG_ENABLED
+                if(! data.histogram_cleared)
+                {
+                    reset();
+                }
+
+                if(data.running)
+                {
+                    hw::sampling_profiler::stop();
+                }
+
+                const hw::sampling_profiler::histogram& histogram = hw::sampling_profiler::data();
+                BN_LOG("sampling_profiler: begin ", histogram.samples_count, ' ', histogram.lost_samples_count);
+
+                for(const hw::sampling_profiler::entry& entry : histogram.entries)
+                {
+                    if(entry.key)
+                    {
+                        unsigned address = hw::sampling_profiler::entry_address(entry.key);
+                        BN_LOG("sampling_profiler: ", reinterpret_cast<const void*>(address), ' ', entry.count);
+                    }
+                }
+
+                BN_LOG("sampling_profiler: end");
+
+                if(data.running)
+                {
+                    hw::sampling_profiler::start(data.timer_ticks);
+                }
+            #endif
+        }
+    }
+#endif
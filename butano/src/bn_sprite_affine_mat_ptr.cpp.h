@@ -46,6 +46,24 @@ optional<sprite_affine_mat_ptr> sprite_affine_mat_ptr::create_optional(const aff
     return result;
 }
 
+sprite_affine_mat_ptr sprite_affine_mat_ptr::create_shared(const affine_mat_attributes& attributes)
+{
+    return sprite_affine_mat_ptr(sprite_affine_mats_manager::create_shared(attributes));
+}
+
+optional<sprite_affine_mat_ptr> sprite_affine_mat_ptr::create_shared_optional(const affine_mat_attributes& attributes)
+{
+    int id = sprite_affine_mats_manager::create_shared_optional(attributes);
+    optional<sprite_affine_mat_ptr> result;
+
+    if(id >= 0)
+    {
+        result = sprite_affine_mat_ptr(id);
+    }
+
+    return result;
+}
+
 sprite_affine_mat_ptr::sprite_affine_mat_ptr(const sprite_affine_mat_ptr& other) :
     sprite_affine_mat_ptr(other._id)
 {
@@ -76,6 +94,11 @@ sprite_affine_mat_ptr::~sprite_affine_mat_ptr()
     }
 }
 
+bool sprite_affine_mat_ptr::shared() const
+{
+    return sprite_affine_mats_manager::shared(_id);
+}
+
 fixed sprite_affine_mat_ptr::rotation_angle() const
 {
     return sprite_affine_mats_manager::rotation_angle(_id);
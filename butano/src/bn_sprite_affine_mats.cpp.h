@@ -20,4 +20,19 @@ int available_count()
     return sprite_affine_mats_manager::available_count();
 }
 
+int shared_count()
+{
+    return sprite_affine_mats_manager::shared_count();
+}
+
+bool shared_by_default()
+{
+    return sprite_affine_mats_manager::shared_by_default();
+}
+
+void set_shared_by_default(bool shared_by_default)
+{
+    sprite_affine_mats_manager::set_shared_by_default(shared_by_default);
+}
+
 }
@@ -6,7 +6,9 @@
 #include "bn_sprite_affine_mats_manager.h"
 
 #include "bn_vector.h"
+#include "bn_unordered_map.h"
 #include "bn_sprites_manager_item.h"
+#include "bn_config_sprite_affine_mats.h"
 #include "bn_affine_mat_attributes_reader.h"
 #include "../hw/include/bn_hw_sprites_constants.h"
 #include "../hw/include/bn_hw_sprite_affine_mats.h"
@@ -25,6 +27,39 @@ namespace
 
     static_assert(max_items <= numeric_limits<int8_t>::max());
 
+    constexpr int shared_rotation_angle_step = fixed(BN_CFG_SPRITE_AFFINE_MATS_SHARED_ROTATION_ANGLE_STEP).data();
+    constexpr int shared_scale_step = fixed(BN_CFG_SPRITE_AFFINE_MATS_SHARED_SCALE_STEP).data();
+
+    static_assert(shared_rotation_angle_step > 0);
+    static_assert(shared_scale_step > 0);
+
+    [[nodiscard]] constexpr int _quantize(int value, int step)
+    {
+        return ((value + (step / 2)) / step) * step;
+    }
+
+    [[nodiscard]] affine_mat_attributes _shared_attributes(const affine_mat_attributes& attributes)
+    {
+        affine_mat_attributes result = attributes;
+        int rotation_angle = _quantize(attributes.rotation_angle().data(), shared_rotation_angle_step);
+        int horizontal_scale = _quantize(attributes.horizontal_scale().data(), shared_scale_step);
+        int vertical_scale = _quantize(attributes.vertical_scale().data(), shared_scale_step);
+        result.set_rotation_angle(fixed::from_data(min(rotation_angle, fixed(360).data())));
+        result.set_scale(fixed::from_data(max(horizontal_scale, shared_scale_step)),
+                         fixed::from_data(max(vertical_scale, shared_scale_step)));
+        return result;
+    }
+
+    [[nodiscard]] uint64_t _shared_key(const affine_mat_attributes& attributes)
+    {
+        // Matrices with the same register values are the same transformation:
+        auto pa = uint64_t(uint16_t(attributes.pa_register_value()));
+        auto pb = uint64_t(uint16_t(attributes.pb_register_value()));
+        auto pc = uint64_t(uint16_t(attributes.pc_register_value()));
+        auto pd = uint64_t(uint16_t(attributes.pd_register_value()));
+        return pa | (pb << 16) | (pc << 32) | (pd << 48);
+    }
+
     template<int half_width, int half_height>
     [[nodiscard]] bool _sprite_double_size(int pa, int pb, int pc, int pd, int divisor)
     {
@@ -64,10 +99,12 @@ namespace
     public:
         affine_mat_attributes attributes;
         intrusive_list<sprite_affine_mat_attach_node_type> attached_nodes;
+        uint64_t shared_key;
         unsigned usages;
         bool flipped_identity;
         bool update;
         bool remove_if_not_needed;
+        bool shared;
 
         void init()
         {
@@ -75,6 +112,7 @@ namespace
             usages = 1;
             flipped_identity = true;
             remove_if_not_needed = false;
+            shared = false;
         }
 
         void init(const affine_mat_attributes& new_attributes)
@@ -83,6 +121,7 @@ namespace
             usages = 1;
             flipped_identity = attributes.flipped_identity();
             remove_if_not_needed = false;
+            shared = false;
         }
 
         [[nodiscard]] bool sprite_double_size(int divisor, const sprite_shape_size& shape_size) const
@@ -164,6 +203,7 @@ namespace
     public:
         item_type items[max_items];
         vector<int8_t, max_items> free_item_indexes;
+        unordered_map<uint64_t, int8_t, max_items * 2> shared_items_map;
         hw::sprite_affine_mats::handle* handles_ptr = nullptr;
         int first_index_to_update = max_items;
         int last_index_to_update = 0;
@@ -171,11 +211,19 @@ namespace
         int last_index_to_remove_if_not_needed = 0;
         int first_index_to_commit = max_items;
         int last_index_to_commit = 0;
+        bool shared_by_default = false;
     };
 
     BN_DATA_EWRAM_BSS static_data data;
 
 
+    void _unshare(item_type& item)
+    {
+        item.shared = false;
+        data.shared_items_map.erase(item.shared_key);
+    }
+
+
     void _update_flipped_identity(int index)
     {
         item_type& item = data.items[index];
@@ -212,6 +260,13 @@ namespace
     void _update(int index)
     {
         item_type& item = data.items[index];
+
+        if(item.shared)
+        {
+            // Shared matrices can't be found anymore after being modified:
+            _unshare(item);
+        }
+
         item.update = true;
         data.first_index_to_update = min(data.first_index_to_update, index);
         data.last_index_to_update = max(data.last_index_to_update, index);
@@ -457,6 +512,92 @@ int create_optional(const affine_mat_attributes& attributes)
     return item_index;
 }
 
+int create_shared(const affine_mat_attributes& attributes)
+{
+    int id = create_shared_optional(attributes);
+    BN_BASIC_ASSERT(id >= 0, "No more sprite affine mats available");
+
+    return id;
+}
+
+int create_shared_optional(const affine_mat_attributes& attributes)
+{
+    affine_mat_attributes shared_attributes = _shared_attributes(attributes);
+    uint64_t shared_key = _shared_key(shared_attributes);
+    auto shared_items_it = data.shared_items_map.find(shared_key);
+
+    if(shared_items_it != data.shared_items_map.end())
+    {
+        int item_index = shared_items_it->second;
+        increase_usages(item_index);
+        return item_index;
+    }
+
+    int item_index = create_optional(shared_attributes);
+
+    if(item_index >= 0)
+    {
+        item_type& item = data.items[item_index];
+        item.shared_key = shared_key;
+        item.shared = true;
+        data.shared_items_map.insert(shared_key, int8_t(item_index));
+    }
+
+    return item_index;
+}
+
+bool shared(int id)
+{
+    return data.items[id].shared;
+}
+
+bool set_shared_attributes(int id, const affine_mat_attributes& attributes)
+{
+    affine_mat_attributes shared_attributes = _shared_attributes(attributes);
+    uint64_t shared_key = _shared_key(shared_attributes);
+    auto shared_items_it = data.shared_items_map.find(shared_key);
+
+    if(shared_items_it != data.shared_items_map.end())
+    {
+        return shared_items_it->second == id;
+    }
+
+    item_type& item = data.items[id];
+
+    if(item.usages > 1)
+    {
+        return false;
+    }
+
+    // Modify the matrix in place instead of allocating a new one if it is not used by anyone else:
+    set_attributes(id, shared_attributes);
+
+    if(item.shared)
+    {
+        _unshare(item);
+    }
+
+    item.shared_key = shared_key;
+    item.shared = true;
+    data.shared_items_map.insert(shared_key, int8_t(id));
+    return true;
+}
+
+int shared_count()
+{
+    return data.shared_items_map.size();
+}
+
+bool shared_by_default()
+{
+    return data.shared_by_default;
+}
+
+void set_shared_by_default(bool shared_by_default)
+{
+    data.shared_by_default = shared_by_default;
+}
+
 void increase_usages(int id)
 {
     item_type& item = data.items[id];
@@ -470,6 +611,11 @@ void decrease_usages(int id)
 
     if(! item.usages)
     {
+        if(item.shared)
+        {
+            _unshare(item);
+        }
+
         item.update = false;
         item.remove_if_not_needed = false;
         data.free_item_indexes.push_back(int8_t(id));
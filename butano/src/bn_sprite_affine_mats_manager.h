@@ -42,6 +42,20 @@ namespace bn::sprite_affine_mats_manager
 
     [[nodiscard]] int create_optional(const affine_mat_attributes& attributes);
 
+    [[nodiscard]] int create_shared(const affine_mat_attributes& attributes);
+
+    [[nodiscard]] int create_shared_optional(const affine_mat_attributes& attributes);
+
+    [[nodiscard]] bool shared(int id);
+
+    [[nodiscard]] bool set_shared_attributes(int id, const affine_mat_attributes& attributes);
+
+    [[nodiscard]] int shared_count();
+
+    [[nodiscard]] bool shared_by_default();
+
+    void set_shared_by_default(bool shared_by_default);
+
     void increase_usages(int id);
 
     void decrease_usages(int id);
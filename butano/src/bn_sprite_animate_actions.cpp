@@ -1,6 +1,7 @@
 #include "bn_sprite_animate_actions.h"
 
 #include "bn_limits.h"
+#include "bn_memory.h"
 
 namespace bn
 {
@@ -240,4 +241,107 @@ void isprite_cached_animate_action::_assign_tiles_list(ivector<sprite_tiles_ptr>
     *_tiles_list_ref = move(tiles_list);
 }
 
+isprite_streamed_animate_action& isprite_streamed_animate_action::operator=(
+        isprite_streamed_animate_action&& other) noexcept
+{
+    if(this != &other)
+    {
+        BN_ASSERT(other.graphics_indexes().size() <= graphics_indexes().max_size(),
+                  "Too many graphics indexes: ", other.graphics_indexes().size(), " - ",
+                  graphics_indexes().max_size());
+
+        *_sprite_ref = move(*other._sprite_ref);
+        *_tiles_item_ref = *other._tiles_item_ref;
+        *_graphics_indexes_ref = *other._graphics_indexes_ref;
+        _tiles_buffers_ref[0] = move(other._tiles_buffers_ref[0]);
+        _tiles_buffers_ref[1] = move(other._tiles_buffers_ref[1]);
+        _assign(other);
+    }
+
+    return *this;
+}
+
+void isprite_streamed_animate_action::update()
+{
+    BN_ASSERT(! done(), "Action is done");
+
+    if(_current_wait_updates)
+    {
+        --_current_wait_updates;
+    }
+    else
+    {
+        const ivector<uint16_t>& graphics_indexes = this->graphics_indexes();
+        int current_graphics_indexes_index = _current_graphics_indexes_index;
+        int current_graphics_index = graphics_indexes[current_graphics_indexes_index];
+        _current_wait_updates = _wait_updates;
+
+        if(current_graphics_indexes_index == 0 ||
+                graphics_indexes[current_graphics_indexes_index - 1] != current_graphics_index)
+        {
+            // The back tiles buffer has not been displayed since the last VBlank, so it can be safely modified:
+            sprite_tiles_ptr& back_tiles = _tiles_buffers_ref[_back_tiles_buffer_index];
+            span<const tile> source_tiles_ref = _tiles_item_ref->graphics_tiles_ref(current_graphics_index);
+            span<tile> back_tiles_vram = *back_tiles.vram();
+            memory::copy(source_tiles_ref[0], source_tiles_ref.size(), back_tiles_vram[0]);
+            _sprite_ref->set_tiles(back_tiles);
+            _back_tiles_buffer_index ^= 1;
+        }
+
+        if(_forever && current_graphics_indexes_index == graphics_indexes.size() - 1)
+        {
+            _current_graphics_indexes_index = 0;
+        }
+        else
+        {
+            ++_current_graphics_indexes_index;
+        }
+    }
+}
+
+void isprite_streamed_animate_action::set_wait_updates(int wait_updates)
+{
+    BN_ASSERT(wait_updates >= 0, "Invalid wait updates: ", wait_updates);
+    BN_ASSERT(wait_updates <= numeric_limits<decltype(_wait_updates)>::max(),
+              "Too many wait updates: ", wait_updates);
+
+    _wait_updates = uint16_t(wait_updates);
+
+    if(wait_updates < _current_wait_updates)
+    {
+        _current_wait_updates = uint16_t(wait_updates);
+    }
+}
+
+void isprite_streamed_animate_action::_set_refs(
+        sprite_ptr& sprite, sprite_tiles_item& tiles_item, ivector<uint16_t>& graphics_indexes,
+        sprite_tiles_ptr* tiles_buffers)
+{
+    _sprite_ref = &sprite;
+    _tiles_item_ref = &tiles_item;
+    _graphics_indexes_ref = &graphics_indexes;
+    _tiles_buffers_ref = tiles_buffers;
+}
+
+void isprite_streamed_animate_action::_assign(const isprite_streamed_animate_action& other)
+{
+    _wait_updates = other._wait_updates;
+    _current_graphics_indexes_index = other._current_graphics_indexes_index;
+    _current_wait_updates = other._current_wait_updates;
+    _back_tiles_buffer_index = other._back_tiles_buffer_index;
+    _forever = other._forever;
+}
+
+void isprite_streamed_animate_action::_assign_graphics_indexes(const span<const uint16_t>& graphics_indexes)
+{
+    BN_ASSERT(_tiles_item_ref->compression() == compression_type::NONE, "Compressed tiles not supported");
+    BN_ASSERT(graphics_indexes.size() > 1 && graphics_indexes.size() <= _graphics_indexes_ref->max_size(),
+              "Invalid graphics indexes count: ", graphics_indexes.size());
+
+    for(uint16_t graphics_index : graphics_indexes)
+    {
+        _graphics_indexes_ref->push_back(graphics_index);
+    }
+}
+
 }
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_sprite_animation_ptr.h"
+
+#include "bn_sprite_ptr.h"
+#include "bn_sprite_animations_manager.h"
+
+namespace bn
+{
+
+sprite_animation_ptr sprite_animation_ptr::once(
+        const sprite_ptr& sprite, int wait_updates, const sprite_tiles_item& tiles_item,
+        const span<const uint16_t>& graphics_indexes)
+{
+    int id = sprite_animations_manager::create(
+                sprite_ptr(sprite), wait_updates, tiles_item, graphics_indexes, false);
+    return sprite_animation_ptr(id);
+}
+
+sprite_animation_ptr sprite_animation_ptr::once(
+        sprite_ptr&& sprite, int wait_updates, const sprite_tiles_item& tiles_item,
+        const span<const uint16_t>& graphics_indexes)
+{
+    int id = sprite_animations_manager::create(move(sprite), wait_updates, tiles_item, graphics_indexes, false);
+    return sprite_animation_ptr(id);
+}
+
+sprite_animation_ptr sprite_animation_ptr::forever(
+        const sprite_ptr& sprite, int wait_updates, const sprite_tiles_item& tiles_item,
+        const span<const uint16_t>& graphics_indexes)
+{
+    int id = sprite_animations_manager::create(
+                sprite_ptr(sprite), wait_updates, tiles_item, graphics_indexes, true);
+    return sprite_animation_ptr(id);
+}
+
+sprite_animation_ptr sprite_animation_ptr::forever(
+        sprite_ptr&& sprite, int wait_updates, const sprite_tiles_item& tiles_item,
+        const span<const uint16_t>& graphics_indexes)
+{
+    int id = sprite_animations_manager::create(move(sprite), wait_updates, tiles_item, graphics_indexes, true);
+    return sprite_animation_ptr(id);
+}
+
+sprite_animation_ptr::sprite_animation_ptr(const sprite_animation_ptr& other) :
+    sprite_animation_ptr(other._id)
+{
+    sprite_animations_manager::increase_usages(_id);
+}
+
+sprite_animation_ptr& sprite_animation_ptr::operator=(const sprite_animation_ptr& other)
+{
+    if(_id != other._id)
+    {
+        if(_id >= 0)
+        {
+            sprite_animations_manager::decrease_usages(_id);
+        }
+
+        _id = other._id;
+        sprite_animations_manager::increase_usages(_id);
+    }
+
+    return *this;
+}
+
+sprite_animation_ptr::~sprite_animation_ptr()
+{
+    if(_id >= 0)
+    {
+        sprite_animations_manager::decrease_usages(_id);
+    }
+}
+
+const sprite_ptr& sprite_animation_ptr::sprite() const
+{
+    return sprite_animations_manager::sprite(_id);
+}
+
+int sprite_animation_ptr::wait_updates() const
+{
+    return sprite_animations_manager::wait_updates(_id);
+}
+
+void sprite_animation_ptr::set_wait_updates(int wait_updates)
+{
+    sprite_animations_manager::set_wait_updates(_id, wait_updates);
+}
+
+bool sprite_animation_ptr::update_forever() const
+{
+    return sprite_animations_manager::update_forever(_id);
+}
+
+int sprite_animation_ptr::frames_count() const
+{
+    return sprite_animations_manager::frames_count(_id);
+}
+
+int sprite_animation_ptr::current_index() const
+{
+    return sprite_animations_manager::current_index(_id);
+}
+
+bool sprite_animation_ptr::done() const
+{
+    return sprite_animations_manager::done(_id);
+}
+
+void sprite_animation_ptr::reset()
+{
+    sprite_animations_manager::reset(_id);
+}
+
+}
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_sprite_animations.h"
+
+#include "bn_sprite_animations_manager.h"
+
+namespace bn::sprite_animations
+{
+
+int used_items_count()
+{
+    return sprite_animations_manager::used_items_count();
+}
+
+int available_items_count()
+{
+    return sprite_animations_manager::available_items_count();
+}
+
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_sprite_animations_manager.h"
+
+#include "bn_limits.h"
+#include "bn_vector.h"
+#include "bn_optional.h"
+#include "bn_sprite_ptr.h"
+#include "bn_sprite_tiles_ptr.h"
+#include "bn_sprite_tiles_item.h"
+#include "bn_config_sprite_animations.h"
+
+#include "bn_sprite_animations.cpp.h"
+#include "bn_sprite_animation_ptr.cpp.h"
+
+namespace bn::sprite_animations_manager
+{
+
+namespace
+{
+    constexpr int max_items = BN_CFG_SPRITE_ANIMATIONS_MAX_ITEMS;
+    constexpr int max_frames = BN_CFG_SPRITE_ANIMATIONS_MAX_FRAMES;
+
+    static_assert(max_items > 0 && max_items <= numeric_limits<int16_t>::max());
+    static_assert(max_frames > 1 && max_frames <= numeric_limits<uint16_t>::max());
+
+
+    class static_data
+    {
+
+    public:
+        // Data read each frame is stored in separate arrays to update all animations in a single pass:
+        uint16_t current_wait_updates[max_items];
+        uint16_t wait_updates[max_items];
+        uint16_t current_indexes[max_items];
+        uint16_t frames_counts[max_items];
+        bool forever[max_items];
+        vector<int16_t, max_items> active_indexes;
+
+        // Data only read when the tiles must be changed:
+        optional<sprite_ptr> sprites[max_items];
+        vector<sprite_tiles_ptr, max_frames> tiles_lists[max_items];
+        unsigned usages[max_items];
+        alignas(int) int16_t free_item_indexes_array[max_items];
+        uint16_t free_item_indexes_size = max_items;
+    };
+
+    BN_DATA_EWRAM_BSS static_data data;
+}
+
+void init()
+{
+    new(&data) static_data();
+
+    for(int index = 0; index < max_items; ++index)
+    {
+        data.free_item_indexes_array[index] = int16_t(index);
+    }
+}
+
+int used_items_count()
+{
+    return max_items - data.free_item_indexes_size;
+}
+
+int available_items_count()
+{
+    return data.free_item_indexes_size;
+}
+
+int create(sprite_ptr&& sprite, int wait_updates, const sprite_tiles_item& tiles_item,
+           const span<const uint16_t>& graphics_indexes, bool forever)
+{
+    BN_BASIC_ASSERT(data.free_item_indexes_size, "No more sprite animations available");
+    BN_ASSERT(wait_updates >= 0 && wait_updates <= numeric_limits<uint16_t>::max(),
+              "Invalid wait updates: ", wait_updates);
+
+    int frames_count = graphics_indexes.size();
+    BN_ASSERT(frames_count > 1 && frames_count <= max_frames, "Invalid frames count: ", frames_count, " - ", max_frames);
+
+    --data.free_item_indexes_size;
+
+    int item_index = data.free_item_indexes_array[data.free_item_indexes_size];
+    vector<sprite_tiles_ptr, max_frames>& tiles_list = data.tiles_lists[item_index];
+
+    for(uint16_t graphics_index : graphics_indexes)
+    {
+        tiles_list.push_back(tiles_item.create_tiles(graphics_index));
+    }
+
+    data.sprites[item_index] = move(sprite);
+    data.current_wait_updates[item_index] = 0;
+    data.wait_updates[item_index] = uint16_t(wait_updates);
+    data.current_indexes[item_index] = 0;
+    data.frames_counts[item_index] = uint16_t(frames_count);
+    data.forever[item_index] = forever;
+    data.usages[item_index] = 1;
+    data.active_indexes.push_back(int16_t(item_index));
+    return item_index;
+}
+
+void increase_usages(int id)
+{
+    ++data.usages[id];
+}
+
+void decrease_usages(int id)
+{
+    --data.usages[id];
+
+    if(! data.usages[id]) [[unlikely]]
+    {
+        data.sprites[id].reset();
+        data.tiles_lists[id].clear();
+        erase(data.active_indexes, int16_t(id));
+        data.free_item_indexes_array[data.free_item_indexes_size] = int16_t(id);
+        ++data.free_item_indexes_size;
+    }
+}
+
+const sprite_ptr& sprite(int id)
+{
+    return *data.sprites[id];
+}
+
+int wait_updates(int id)
+{
+    return data.wait_updates[id];
+}
+
+void set_wait_updates(int id, int wait_updates)
+{
+    BN_ASSERT(wait_updates >= 0 && wait_updates <= numeric_limits<uint16_t>::max(),
+              "Invalid wait updates: ", wait_updates);
+
+    data.wait_updates[id] = uint16_t(wait_updates);
+}
+
+bool update_forever(int id)
+{
+    return data.forever[id];
+}
+
+int frames_count(int id)
+{
+    return data.frames_counts[id];
+}
+
+int current_index(int id)
+{
+    return data.current_indexes[id];
+}
+
+bool done(int id)
+{
+    return data.current_indexes[id] == data.frames_counts[id];
+}
+
+void reset(int id)
+{
+    data.current_wait_updates[id] = 0;
+    data.current_indexes[id] = 0;
+}
+
+void update()
+{
+    for(int16_t index : data.active_indexes)
+    {
+        if(int current_wait_updates = data.current_wait_updates[index])
+        {
+            data.current_wait_updates[index] = uint16_t(current_wait_updates - 1);
+            continue;
+        }
+
+        int current_index = data.current_indexes[index];
+        int frames_count = data.frames_counts[index];
+
+        if(current_index == frames_count)
+        {
+            continue;
+        }
+
+        data.sprites[index]->set_tiles(data.tiles_lists[index][current_index]);
+        data.current_wait_updates[index] = data.wait_updates[index];
+        ++current_index;
+
+        if(current_index == frames_count && data.forever[index])
+        {
+            current_index = 0;
+        }
+
+        data.current_indexes[index] = uint16_t(current_index);
+    }
+}
+
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_SPRITE_ANIMATIONS_MANAGER_H
+#define BN_SPRITE_ANIMATIONS_MANAGER_H
+
+#include "bn_span.h"
+
+namespace bn
+{
+    class sprite_ptr;
+    class sprite_tiles_item;
+}
+
+namespace bn::sprite_animations_manager
+{
+    void init();
+
+    [[nodiscard]] int used_items_count();
+
+    [[nodiscard]] int available_items_count();
+
+    [[nodiscard]] int create(sprite_ptr&& sprite, int wait_updates, const sprite_tiles_item& tiles_item,
+                             const span<const uint16_t>& graphics_indexes, bool forever);
+
+    void increase_usages(int id);
+
+    void decrease_usages(int id);
+
+    [[nodiscard]] const sprite_ptr& sprite(int id);
+
+    [[nodiscard]] int wait_updates(int id);
+
+    void set_wait_updates(int id, int wait_updates);
+
+    [[nodiscard]] bool update_forever(int id);
+
+    [[nodiscard]] int frames_count(int id);
+
+    [[nodiscard]] int current_index(int id);
+
+    [[nodiscard]] bool done(int id);
+
+    void reset(int id);
+
+    void update();
+}
+
+#endif
@@ -21,6 +21,16 @@ int available_colors_count()
     return palettes_manager::sprite_palettes_bank().available_colors_count();
 }
 
+int reused_palettes_count()
+{
+    return palettes_manager::sprite_palettes_bank().reused_palettes_count();
+}
+
+int created_palettes_count()
+{
+    return palettes_manager::sprite_palettes_bank().created_palettes_count();
+}
+
 fixed brightness()
 {
     return palettes_manager::sprite_palettes_bank().brightness();
@@ -476,7 +476,9 @@ void sprite_ptr::set_rotation_angle(fixed rotation_angle)
 
     if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
     {
-        affine_mat_ptr->set_rotation_angle(rotation_angle);
+        affine_mat_attributes mat_attributes = affine_mat_ptr->attributes();
+        mat_attributes.set_rotation_angle(rotation_angle);
+        sprites_manager::set_affine_mat_attributes(_handle, mat_attributes);
     }
     else if(rotation_angle != 0)
     {
@@ -504,7 +506,9 @@ void sprite_ptr::set_horizontal_scale(fixed horizontal_scale)
 
     if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
     {
-        affine_mat_ptr->set_horizontal_scale(horizontal_scale);
+        affine_mat_attributes mat_attributes = affine_mat_ptr->attributes();
+        mat_attributes.set_horizontal_scale(horizontal_scale);
+        sprites_manager::set_affine_mat_attributes(_handle, mat_attributes);
     }
     else if(horizontal_scale != 1)
     {
@@ -532,7 +536,9 @@ void sprite_ptr::set_vertical_scale(fixed vertical_scale)
 
     if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
     {
-        affine_mat_ptr->set_vertical_scale(vertical_scale);
+        affine_mat_attributes mat_attributes = affine_mat_ptr->attributes();
+        mat_attributes.set_vertical_scale(vertical_scale);
+        sprites_manager::set_affine_mat_attributes(_handle, mat_attributes);
     }
     else if(vertical_scale != 1)
     {
@@ -548,7 +554,9 @@ void sprite_ptr::set_scale(fixed scale)
 
     if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
     {
-        affine_mat_ptr->set_scale(scale);
+        affine_mat_attributes mat_attributes = affine_mat_ptr->attributes();
+        mat_attributes.set_scale(scale);
+        sprites_manager::set_affine_mat_attributes(_handle, mat_attributes);
     }
     else if(scale != 1)
     {
@@ -564,7 +572,9 @@ void sprite_ptr::set_scale(fixed horizontal_scale, fixed vertical_scale)
 
     if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
     {
-        affine_mat_ptr->set_scale(horizontal_scale, vertical_scale);
+        affine_mat_attributes mat_attributes = affine_mat_ptr->attributes();
+        mat_attributes.set_scale(horizontal_scale, vertical_scale);
+        sprites_manager::set_affine_mat_attributes(_handle, mat_attributes);
     }
     else if(horizontal_scale != 1 || vertical_scale != 1)
     {
@@ -592,7 +602,9 @@ void sprite_ptr::set_horizontal_shear(fixed horizontal_shear)
 
     if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
     {
-        affine_mat_ptr->set_horizontal_shear(horizontal_shear);
+        affine_mat_attributes mat_attributes = affine_mat_ptr->attributes();
+        mat_attributes.set_horizontal_shear(horizontal_shear);
+        sprites_manager::set_affine_mat_attributes(_handle, mat_attributes);
     }
     else if(horizontal_shear != 0)
     {
@@ -620,7 +632,9 @@ void sprite_ptr::set_vertical_shear(fixed vertical_shear)
 
     if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
     {
-        affine_mat_ptr->set_vertical_shear(vertical_shear);
+        affine_mat_attributes mat_attributes = affine_mat_ptr->attributes();
+        mat_attributes.set_vertical_shear(vertical_shear);
+        sprites_manager::set_affine_mat_attributes(_handle, mat_attributes);
     }
     else if(vertical_shear != 0)
     {
@@ -636,7 +650,9 @@ void sprite_ptr::set_shear(fixed shear)
 
     if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
     {
-        affine_mat_ptr->set_shear(shear);
+        affine_mat_attributes mat_attributes = affine_mat_ptr->attributes();
+        mat_attributes.set_shear(shear);
+        sprites_manager::set_affine_mat_attributes(_handle, mat_attributes);
     }
     else if(shear != 0)
     {
@@ -652,7 +668,9 @@ void sprite_ptr::set_shear(fixed horizontal_shear, fixed vertical_shear)
 
     if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
     {
-        affine_mat_ptr->set_shear(horizontal_shear, vertical_shear);
+        affine_mat_attributes mat_attributes = affine_mat_ptr->attributes();
+        mat_attributes.set_shear(horizontal_shear, vertical_shear);
+        sprites_manager::set_affine_mat_attributes(_handle, mat_attributes);
     }
     else if(horizontal_shear != 0 || vertical_shear != 0)
     {
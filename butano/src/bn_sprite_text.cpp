@@ -0,0 +1,477 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_sprite_text.h"
+
+#include "bn_algorithm.h"
+#include "bn_sprite_builder.h"
+#include "../hw/include/bn_hw_sprite_tiles.h"
+
+namespace bn
+{
+
+namespace
+{
+    constexpr int max_columns_per_sprite = 32;
+
+    // Glyphs count of the columns with unknown contents, which must be redrawn:
+    constexpr int unknown_glyphs_count = 255;
+
+
+    class glyph_type
+    {
+
+    public:
+        int16_t graphics_index;
+        int8_t sprite_index;
+        int8_t column;
+        int8_t width;
+    };
+
+
+    [[nodiscard]] int _graphics_index(char character, const utf8_characters_map_ref& utf8_characters_map,
+                                      const char* text_data, int& text_index)
+    {
+        int result;
+
+        if(character <= '~')
+        {
+            result = character - '!';
+            ++text_index;
+        }
+        else
+        {
+            utf8_character utf8_char(text_data[text_index]);
+            result = utf8_characters_map.index(utf8_char) + sprite_font::minimum_graphics;
+            text_index += utf8_char.size();
+        }
+
+        return result;
+    }
+
+    [[nodiscard]] uint32_t _glyph_key(const glyph_type& glyph)
+    {
+        return (uint32_t(uint16_t(glyph.graphics_index)) << 16) + (uint32_t(uint8_t(glyph.column)) << 8) +
+                uint32_t(uint8_t(glyph.width));
+    }
+
+    void _paint_glyph(const sprite_font& font, bool fixed_width, int character_width, int character_height,
+                      const glyph_type& glyph, tile* tiles_vram)
+    {
+        const sprite_tiles_item& tiles_item = font.item().tiles_item();
+        int graphics_index = glyph.graphics_index;
+        int column = glyph.column;
+
+        if(fixed_width)
+        {
+            int tiles_per_character = character_width / 8;
+            const tile* source_tiles_data = tiles_item.graphics_tiles_ref(graphics_index).data();
+            tile* up_tiles_vram_ptr = tiles_vram + (column / 8);
+            hw::sprite_tiles::copy_tiles(source_tiles_data, tiles_per_character, up_tiles_vram_ptr);
+
+            if(character_height == 16)
+            {
+                hw::sprite_tiles::copy_tiles(source_tiles_data + tiles_per_character, tiles_per_character,
+                                             up_tiles_vram_ptr + (max_columns_per_sprite / 8));
+            }
+        }
+        else
+        {
+            const tile* source_tiles_data = tiles_item.tiles_ref().data();
+            int width = glyph.width;
+
+            if(character_height == 8)
+            {
+                hw::sprite_tiles::plot_tiles(width, source_tiles_data, graphics_index * 8, column, tiles_vram);
+            }
+            else if(character_width == 8)
+            {
+                int source_y = graphics_index * 16;
+                hw::sprite_tiles::plot_tiles(width, source_tiles_data, source_y, column, tiles_vram);
+                hw::sprite_tiles::plot_tiles(width, source_tiles_data, source_y + 8,
+                                             column + max_columns_per_sprite, tiles_vram);
+            }
+            else
+            {
+                int source_y = graphics_index * 32;
+
+                if(width > 8)
+                {
+                    hw::sprite_tiles::plot_tiles(width, source_tiles_data, source_y, column, tiles_vram);
+                    hw::sprite_tiles::plot_tiles(width, source_tiles_data, source_y + 16,
+                                                 column + max_columns_per_sprite, tiles_vram);
+                    source_tiles_data += 1;
+                    tiles_vram += 1;
+                    width -= 8;
+                }
+
+                hw::sprite_tiles::plot_tiles(width, source_tiles_data, source_y, column, tiles_vram);
+                hw::sprite_tiles::plot_tiles(width, source_tiles_data, source_y + 16,
+                                             column + max_columns_per_sprite, tiles_vram);
+            }
+        }
+    }
+}
+
+sprite_text::sprite_text(const sprite_text_generator& generator, const fixed_point& position) :
+    _generator(generator),
+    _palette(generator.palette_item().create_palette()),
+    _position(position)
+{
+    const sprite_font& font = generator.font();
+    const sprite_shape_size& shape_size = font.item().shape_size();
+    int width = shape_size.width();
+    int height = shape_size.height();
+    _character_width = int8_t(width);
+    _character_height = int8_t(height);
+    _fixed_width = font.character_widths_ref().empty();
+
+    BN_ASSERT(! generator.one_sprite_per_character(), "One sprite per character not supported");
+    BN_ASSERT(_fixed_width ?
+                  ! font.space_between_characters() && width <= 16 && height <= 16 :
+                  (width == 8 && height == 8) || (width == 8 && height == 16) || (width == 16 && height == 16),
+              "Font not supported: ", width, " - ", height, " - ", font.space_between_characters());
+}
+
+sprite_text::sprite_text(const sprite_text_generator& generator, const fixed_point& position,
+                         const string_view& text) :
+    sprite_text(generator, position)
+{
+    set_text(text);
+}
+
+void sprite_text::set_position(const fixed_point& position)
+{
+    if(position != _position)
+    {
+        _position = position;
+        _update_sprites();
+    }
+}
+
+void sprite_text::set_visible(bool visible)
+{
+    if(visible != _visible)
+    {
+        _visible = visible;
+        _update_sprites();
+    }
+}
+
+void sprite_text::set_text(const string_view& text)
+{
+    const sprite_font& font = _generator.font();
+    const utf8_characters_map_ref& utf8_characters_map = font.utf8_characters_ref();
+    const int8_t* character_widths = font.character_widths_ref().data();
+    int space_between_characters = font.space_between_characters();
+    int character_width = _character_width;
+    bool fixed_width = _fixed_width;
+    int space_width = fixed_width ? character_width : character_widths[0];
+
+    // Layout (same rules as sprite_text_generator):
+
+    vector<glyph_type, _max_glyphs> glyphs;
+    uint32_t glyph_keys[_max_glyphs];
+    uint8_t column_first_glyphs[_max_columns] = {};
+    uint8_t column_glyphs_counts[_max_columns] = {};
+    int16_t sprite_x_offsets[max_sprites];
+    const char* text_data = text.data();
+    int text_index = 0;
+    int text_size = text.size();
+    int sprite_index = -1;
+    int sprite_column = max_columns_per_sprite;
+    int x = 0;
+
+    while(text_index < text_size)
+    {
+        char character = text_data[text_index];
+
+        if(character == ' ')
+        {
+            int width_with_space = space_width + space_between_characters;
+            sprite_column += width_with_space;
+            x += width_with_space;
+            ++text_index;
+        }
+        else if(character == '\t')
+        {
+            int width_with_space = (space_width * 4) + space_between_characters;
+
+            if(fixed_width)
+            {
+                sprite_column = max_columns_per_sprite;
+            }
+            else
+            {
+                sprite_column += width_with_space;
+            }
+
+            x += width_with_space;
+            ++text_index;
+        }
+        else if(character >= '!')
+        {
+            int graphics_index = _graphics_index(character, utf8_characters_map, text_data, text_index);
+            int width = fixed_width ? character_width : character_widths[graphics_index + 1];
+
+            if(width)
+            {
+                int width_with_space = width + space_between_characters;
+
+                if(sprite_column + width_with_space > max_columns_per_sprite)
+                {
+                    ++sprite_index;
+                    BN_BASIC_ASSERT(sprite_index < max_sprites, "Too many sprites required: ", text);
+
+                    sprite_x_offsets[sprite_index] = int16_t(x + (max_columns_per_sprite / 2));
+                    sprite_column = 0;
+                }
+
+                BN_BASIC_ASSERT(! glyphs.full(), "Too many characters: ", text);
+
+                glyph_type glyph;
+                glyph.graphics_index = int16_t(graphics_index);
+                glyph.sprite_index = int8_t(sprite_index);
+                glyph.column = int8_t(sprite_column);
+                glyph.width = int8_t(width);
+
+                // Glyphs are added from left to right, so the glyphs of each column are contiguous:
+                int glyph_index = glyphs.size();
+                glyphs.push_back(glyph);
+                glyph_keys[glyph_index] = _glyph_key(glyph);
+
+                int first_column = (sprite_index * _columns_per_sprite) + (sprite_column / 8);
+                int last_column = (sprite_index * _columns_per_sprite) + ((sprite_column + width - 1) / 8);
+
+                for(int column = first_column; column <= last_column; ++column)
+                {
+                    if(! column_glyphs_counts[column])
+                    {
+                        column_first_glyphs[column] = uint8_t(glyph_index);
+                    }
+
+                    ++column_glyphs_counts[column];
+                }
+
+                sprite_column += width_with_space;
+                x += width_with_space;
+            }
+            else
+            {
+                sprite_column += space_between_characters;
+                x += space_between_characters;
+            }
+        }
+        else
+        {
+            BN_ERROR("Invalid character: ", character, " (text: ", text, ")");
+        }
+    }
+
+    int used_sprites_count = sprite_index + 1;
+
+    while(_sprites.size() < used_sprites_count)
+    {
+        _add_sprite();
+    }
+
+    // Redraw changed columns:
+
+    int tiles_per_column = _character_height / 8;
+    int updated_tiles_count = 0;
+
+    for(int current_sprite_index = 0; current_sprite_index < used_sprites_count; ++current_sprite_index)
+    {
+        int first_sprite_column = current_sprite_index * _columns_per_sprite;
+        bool dirty_columns[_columns_per_sprite];
+        bool dirty = false;
+
+        for(int column = 0; column < _columns_per_sprite; ++column)
+        {
+            int column_index = first_sprite_column + column;
+            int glyphs_count = column_glyphs_counts[column_index];
+            bool dirty_column = glyphs_count != _column_glyphs_counts[column_index];
+
+            if(! dirty_column && glyphs_count)
+            {
+                const uint32_t* column_glyph_keys = glyph_keys + column_first_glyphs[column_index];
+                const uint32_t* old_column_glyph_keys = _glyph_keys + _column_first_glyphs[column_index];
+                dirty_column = ! equal(column_glyph_keys, column_glyph_keys + glyphs_count, old_column_glyph_keys);
+            }
+
+            dirty_columns[column] = dirty_column;
+            dirty |= dirty_column;
+        }
+
+        if(! dirty)
+        {
+            continue;
+        }
+
+        // Glyphs that touch a dirty column are redrawn entirely, so all of their columns must be cleared:
+
+        bool expanded = true;
+
+        while(expanded)
+        {
+            expanded = false;
+
+            for(const glyph_type& glyph : glyphs)
+            {
+                if(glyph.sprite_index == current_sprite_index)
+                {
+                    int first_column = glyph.column / 8;
+                    int last_column = (glyph.column + glyph.width - 1) / 8;
+                    bool touches_dirty_column = false;
+
+                    for(int column = first_column; column <= last_column; ++column)
+                    {
+                        touches_dirty_column |= dirty_columns[column];
+                    }
+
+                    if(touches_dirty_column)
+                    {
+                        for(int column = first_column; column <= last_column; ++column)
+                        {
+                            expanded |= ! dirty_columns[column];
+                            dirty_columns[column] = true;
+                        }
+                    }
+                }
+            }
+        }
+
+        tile* tiles_vram = _sprites_tiles_vram[current_sprite_index];
+
+        for(int column = 0; column < _columns_per_sprite; ++column)
+        {
+            if(dirty_columns[column])
+            {
+                hw::sprite_tiles::clear_tiles(1, tiles_vram + column);
+
+                if(tiles_per_column > 1)
+                {
+                    hw::sprite_tiles::clear_tiles(1, tiles_vram + column + _columns_per_sprite);
+                }
+
+                updated_tiles_count += tiles_per_column;
+            }
+        }
+
+        for(const glyph_type& glyph : glyphs)
+        {
+            if(glyph.sprite_index == current_sprite_index && dirty_columns[glyph.column / 8])
+            {
+                _paint_glyph(font, fixed_width, character_width, _character_height, glyph, tiles_vram);
+            }
+        }
+    }
+
+    for(int index = 0; index < used_sprites_count; ++index)
+    {
+        _sprite_x_offsets[index] = sprite_x_offsets[index];
+    }
+
+    // Hidden sprites keep their tiles, so the glyphs of their columns are kept too (if there's room for them):
+
+    int glyphs_count = glyphs.size();
+    int columns_count = _sprites.size() * _columns_per_sprite;
+
+    for(int column = used_sprites_count * _columns_per_sprite; column < columns_count; ++column)
+    {
+        int column_glyphs_count = _column_glyphs_counts[column];
+
+        if(column_glyphs_count == unknown_glyphs_count || glyphs_count + column_glyphs_count > _max_glyphs)
+        {
+            column_glyphs_counts[column] = unknown_glyphs_count;
+        }
+        else
+        {
+            copy_n(_glyph_keys + _column_first_glyphs[column], column_glyphs_count, glyph_keys + glyphs_count);
+            column_first_glyphs[column] = uint8_t(glyphs_count);
+            column_glyphs_counts[column] = uint8_t(column_glyphs_count);
+            glyphs_count += column_glyphs_count;
+        }
+    }
+
+    copy_n(glyph_keys, glyphs_count, _glyph_keys);
+    copy_n(column_first_glyphs, columns_count, _column_first_glyphs);
+    copy_n(column_glyphs_counts, columns_count, _column_glyphs_counts);
+
+    _width = x;
+    _used_sprites_count = used_sprites_count;
+    _last_updated_tiles_count = updated_tiles_count;
+    _total_updated_tiles_count += updated_tiles_count;
+    _update_sprites();
+}
+
+void sprite_text::_add_sprite()
+{
+    sprite_shape_size shape_size(sprite_shape::WIDE, _character_height == 8 ? sprite_size::NORMAL : sprite_size::BIG);
+    int tiles_count = shape_size.tiles_count(bpp_mode::BPP_4);
+    sprite_tiles_ptr tiles = sprite_tiles_ptr::allocate(tiles_count, bpp_mode::BPP_4);
+    tile* tiles_vram = tiles.vram()->data();
+    hw::sprite_tiles::clear_tiles(tiles_count, tiles_vram);
+
+    sprite_builder builder(shape_size, move(tiles), _palette);
+    builder.set_bg_priority(_generator.bg_priority());
+    builder.set_z_order(_generator.z_order());
+    builder.set_visible(false);
+
+    int sprite_index = _sprites.size();
+    _sprites.push_back(sprite_ptr::create(move(builder)));
+    _sprites_tiles_vram[sprite_index] = tiles_vram;
+    _total_updated_tiles_count += tiles_count;
+
+    for(int column = 0; column < _columns_per_sprite; ++column)
+    {
+        _column_glyphs_counts[(sprite_index * _columns_per_sprite) + column] = 0;
+    }
+}
+
+void sprite_text::_update_sprites()
+{
+    fixed x = _position.x();
+
+    switch(_generator.alignment())
+    {
+
+    case sprite_text_generator::alignment_type::LEFT:
+        break;
+
+    case sprite_text_generator::alignment_type::CENTER:
+        x -= _width / 2;
+        break;
+
+    case sprite_text_generator::alignment_type::RIGHT:
+        x -= _width;
+        break;
+
+    default:
+        BN_ERROR("Invalid alignment: ", int(_generator.alignment()));
+        break;
+    }
+
+    fixed y = _position.y();
+    int used_sprites_count = _used_sprites_count;
+    bool visible = _visible;
+
+    for(int index = 0, limit = _sprites.size(); index < limit; ++index)
+    {
+        sprite_ptr& sprite = _sprites[index];
+
+        if(index < used_sprites_count)
+        {
+            sprite.set_position(x + _sprite_x_offsets[index], y);
+            sprite.set_visible(visible);
+        }
+        else
+        {
+            sprite.set_visible(false);
+        }
+    }
+}
+
+}
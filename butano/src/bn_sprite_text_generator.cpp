@@ -7,6 +7,7 @@
 
 #include "bn_sprites.h"
 #include "bn_sprite_ptr.h"
+#include "bn_text_layout.h"
 #include "bn_sprite_builder.h"
 #include "../hw/include/bn_hw_sprite_tiles.h"
 
@@ -1007,30 +1008,9 @@ namespace
         return true;
     }
 
-    template<bool allow_failure>
-    bool _generate(const sprite_text_generator& generator, const fixed_point& position, const string_view& text,
-                   const utf8_characters_map_ref& utf8_characters_map, int max_character_width, int character_height,
-                   bool one_sprite_per_character, ivector<sprite_ptr>& output_sprites)
+    [[nodiscard]] fixed_point _aligned_position(const sprite_text_generator& generator, const fixed_point& position,
+                                                const string_view& text)
     {
-        optional<sprite_palette_ptr> palette;
-        sprite_palette_ptr* palette_ptr;
-
-        if(allow_failure)
-        {
-            palette = generator.palette_item().create_palette_optional();
-            palette_ptr = palette.get();
-
-            if(! palette_ptr)
-            {
-                return false;
-            }
-        }
-        else
-        {
-            palette = generator.palette_item().create_palette();
-            palette_ptr = palette.get();
-        }
-
         fixed_point aligned_position = position;
 
         switch(generator.alignment())
@@ -1052,6 +1032,34 @@ namespace
             break;
         }
 
+        return aligned_position;
+    }
+
+    template<bool allow_failure>
+    bool _generate(const sprite_text_generator& generator, const fixed_point& aligned_position,
+                   const string_view& text, const utf8_characters_map_ref& utf8_characters_map,
+                   int max_character_width, int character_height, bool one_sprite_per_character,
+                   ivector<sprite_ptr>& output_sprites)
+    {
+        optional<sprite_palette_ptr> palette;
+        sprite_palette_ptr* palette_ptr;
+
+        if(allow_failure)
+        {
+            palette = generator.palette_item().create_palette_optional();
+            palette_ptr = palette.get();
+
+            if(! palette_ptr)
+            {
+                return false;
+            }
+        }
+        else
+        {
+            palette = generator.palette_item().create_palette();
+            palette_ptr = palette.get();
+        }
+
         const sprite_font& font = generator.font();
         int output_sprites_count = output_sprites.size();
         bool fixed_width = font.character_widths_ref().empty();
@@ -1220,7 +1228,8 @@ void sprite_text_generator::generate(fixed x, fixed y, const string_view& text,
                                      ivector<sprite_ptr>& output_sprites) const
 {
     bool one_sprite_per_character = _one_sprite_per_character || _font_one_sprite_per_character;
-    _generate<false>(*this, fixed_point(x, y), text, _font.utf8_characters_ref(), _max_character_width,
+    fixed_point aligned_position = _aligned_position(*this, fixed_point(x, y), text);
+    _generate<false>(*this, aligned_position, text, _font.utf8_characters_ref(), _max_character_width,
                      _character_height, one_sprite_per_character, output_sprites);
 }
 
@@ -1228,15 +1237,56 @@ void sprite_text_generator::generate(const fixed_point& position, const string_v
                                      ivector<sprite_ptr>& output_sprites) const
 {
     bool one_sprite_per_character = _one_sprite_per_character || _font_one_sprite_per_character;
-    _generate<false>(*this, position, text, _font.utf8_characters_ref(), _max_character_width,
+    fixed_point aligned_position = _aligned_position(*this, position, text);
+    _generate<false>(*this, aligned_position, text, _font.utf8_characters_ref(), _max_character_width,
                      _character_height, one_sprite_per_character, output_sprites);
 }
 
+void sprite_text_generator::generate(const fixed_point& position, const text_layout& layout,
+                                     ivector<sprite_ptr>& output_sprites) const
+{
+    generate(position, layout, layout.characters_count(), output_sprites);
+}
+
+void sprite_text_generator::generate(const fixed_point& position, const text_layout& layout, int characters_count,
+                                     ivector<sprite_ptr>& output_sprites) const
+{
+    BN_ASSERT(characters_count >= 0, "Invalid characters count: ", characters_count);
+
+    bool one_sprite_per_character = _one_sprite_per_character || _font_one_sprite_per_character;
+    const utf8_characters_map_ref& utf8_characters_map = _font.utf8_characters_ref();
+    fixed x = position.x();
+    fixed y = position.y();
+
+    for(int line_index = 0, lines_count = layout.lines_count(); line_index < lines_count; ++line_index)
+    {
+        const text_layout::line_type& line = layout.lines()[line_index];
+        int line_characters_count = characters_count - line.characters_position;
+
+        if(line_characters_count <= 0)
+        {
+            break;
+        }
+
+        string_view line_text = layout.line_text(line_index, line_characters_count);
+
+        if(! line_text.empty())
+        {
+            fixed_point line_position(x + line.x, y);
+            _generate<false>(*this, line_position, line_text, utf8_characters_map, _max_character_width,
+                             _character_height, one_sprite_per_character, output_sprites);
+        }
+
+        y += _character_height;
+    }
+}
+
 bool sprite_text_generator::generate_optional(fixed x, fixed y, const string_view& text,
                                               ivector<sprite_ptr>& output_sprites) const
 {
     bool one_sprite_per_character = _one_sprite_per_character || _font_one_sprite_per_character;
-    return _generate<true>(*this, fixed_point(x, y), text, _font.utf8_characters_ref(), _max_character_width,
+    fixed_point aligned_position = _aligned_position(*this, fixed_point(x, y), text);
+    return _generate<true>(*this, aligned_position, text, _font.utf8_characters_ref(), _max_character_width,
                            _character_height, one_sprite_per_character, output_sprites);
 }
 
@@ -1244,7 +1294,8 @@ bool sprite_text_generator::generate_optional(const fixed_point& position, const
                                               ivector<sprite_ptr>& output_sprites) const
 {
     bool one_sprite_per_character = _one_sprite_per_character || _font_one_sprite_per_character;
-    return _generate<true>(*this, position, text, _font.utf8_characters_ref(), _max_character_width,
+    fixed_point aligned_position = _aligned_position(*this, position, text);
+    return _generate<true>(*this, aligned_position, text, _font.utf8_characters_ref(), _max_character_width,
                            _character_height, one_sprite_per_character, output_sprites);
 }
 
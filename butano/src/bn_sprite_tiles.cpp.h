@@ -30,6 +30,21 @@ int available_items_count()
     return sprite_tiles_manager::available_items_count();
 }
 
+int largest_available_block_tiles_count()
+{
+    return sprite_tiles_manager::largest_available_block_tiles_count();
+}
+
+int compaction_bytes_per_frame()
+{
+    return sprite_tiles_manager::compaction_bytes_per_frame();
+}
+
+void set_compaction_bytes_per_frame(int bytes)
+{
+    sprite_tiles_manager::set_compaction_bytes_per_frame(bytes);
+}
+
 void log_status()
 {
     #if BN_CFG_LOG_ENABLED
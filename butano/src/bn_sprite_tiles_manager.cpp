@@ -33,6 +33,7 @@ namespace
     static_assert(BN_CFG_SPRITE_TILES_MAX_ITEMS > 0 &&
                   BN_CFG_SPRITE_TILES_MAX_ITEMS <= hw::sprite_tiles::tiles_count());
     static_assert(power_of_two(BN_CFG_SPRITE_TILES_MAX_ITEMS));
+    static_assert(BN_CFG_SPRITE_TILES_COMPACTION_BYTES_PER_FRAME >= 0);
 
 
     #if BN_CFG_LOG_ENABLED
@@ -269,6 +270,7 @@ namespace
         vector<uint16_t, max_items> to_commit_compressed_items;
         uint16_t free_tiles_count = 0;
         uint16_t to_remove_tiles_count = 0;
+        int compaction_bytes_per_frame = BN_CFG_SPRITE_TILES_COMPACTION_BYTES_PER_FRAME;
         bool delay_commit = false;
     };
 
@@ -731,6 +733,24 @@ int available_items_count()
     return data.items.available();
 }
 
+int largest_available_block_tiles_count()
+{
+    const vector<uint16_t, max_items>& free_items = data.free_items;
+    return free_items.empty() ? 0 : int(data.items.item(free_items.back()).tiles_count);
+}
+
+int compaction_bytes_per_frame()
+{
+    return data.compaction_bytes_per_frame;
+}
+
+void set_compaction_bytes_per_frame(int bytes)
+{
+    BN_ASSERT(bytes >= 0, "Invalid bytes: ", bytes);
+
+    data.compaction_bytes_per_frame = bytes;
+}
+
 #if BN_CFG_LOG_ENABLED
     void log_status()
     {
@@ -1100,6 +1120,87 @@ void update()
     data.delay_commit = false;
 }
 
+bool compact()
+{
+    int available_tiles = data.compaction_bytes_per_frame / int(sizeof(tile));
+
+    if(! available_tiles || data.free_items.size() < 2 || data.to_remove_tiles_count)
+    {
+        return false;
+    }
+
+    BN_SPRITE_TILES_LOG("sprite_tiles_manager - COMPACT");
+
+    auto iterator = data.items.begin();
+    auto end = data.items.end();
+    bool moved = false;
+
+    while(iterator != end)
+    {
+        auto next_iterator = iterator;
+        ++next_iterator;
+
+        if(next_iterator == end)
+        {
+            break;
+        }
+
+        const item_type& free_item = *iterator;
+        item_type& used_item = *next_iterator;
+
+        // Allocated items (the ones without data) are not moved, since their tiles can be referenced with spans:
+        if(free_item.status() != status_type::FREE || ! used_item.data ||
+                int(used_item.tiles_count) > available_tiles)
+        {
+            iterator = next_iterator;
+            continue;
+        }
+
+        int free_item_id = iterator.id();
+        int free_start_tile = int(free_item.start_tile);
+        int free_tiles_count = int(free_item.tiles_count);
+        _erase_free_item(free_item_id);
+        data.items.erase(free_item_id);
+
+        int used_item_id = next_iterator.id();
+        used_item.start_tile = unsigned(free_start_tile);
+        _insert_to_commit_item(used_item_id, used_item);
+        available_tiles -= int(used_item.tiles_count);
+        moved = true;
+
+        int new_free_start_tile = free_start_tile + int(used_item.tiles_count);
+        iterator = next_iterator;
+        ++iterator;
+
+        if(iterator != end && (*iterator).status() == status_type::FREE)
+        {
+            int next_free_item_id = iterator.id();
+            item_type& next_free_item = *iterator;
+            _erase_free_item(next_free_item_id);
+            next_free_item.start_tile = unsigned(new_free_start_tile);
+            next_free_item.tiles_count += unsigned(free_tiles_count);
+            _insert_free_item(next_free_item_id);
+        }
+        else
+        {
+            item_type new_item;
+            new_item.start_tile = unsigned(new_free_start_tile);
+            new_item.tiles_count = unsigned(free_tiles_count);
+            iterator = data.items.insert(iterator.id(), new_item);
+            _insert_free_item(iterator.id());
+        }
+
+        if(! available_tiles)
+        {
+            break;
+        }
+    }
+
+    BN_SPRITE_TILES_LOG_STATUS();
+
+    return moved;
+}
+
 void commit_uncompressed(bool use_dma)
 {
     if(! data.to_commit_uncompressed_items.empty())
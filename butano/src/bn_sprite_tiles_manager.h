@@ -29,6 +29,12 @@ namespace bn::sprite_tiles_manager
 
     [[nodiscard]] int available_items_count();
 
+    [[nodiscard]] int largest_available_block_tiles_count();
+
+    [[nodiscard]] int compaction_bytes_per_frame();
+
+    void set_compaction_bytes_per_frame(int bytes);
+
     #if BN_CFG_LOG_ENABLED
         void log_status();
     #endif
@@ -63,6 +69,8 @@ namespace bn::sprite_tiles_manager
 
     void update();
 
+    [[nodiscard]] bool compact();
+
     void commit_uncompressed(bool use_dma);
 
     void commit_compressed();
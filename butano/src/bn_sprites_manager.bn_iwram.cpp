@@ -90,24 +90,19 @@ int _rebuild_handles_impl(int reserved_handles_count, void* hw_handles, intrusiv
     return visible_items_count;
 }
 
-bool _update_cameras_impl(intrusive_list<sorted_sprites::layer>& layers)
+bool _update_camera_impl(intrusive_list<camera_attach_node_type>& attached_nodes)
 {
     bool check_items_on_screen = false;
 
-    for(sorted_sprites::layer& layer : layers)
+    for(camera_attach_node_type& attached_node : attached_nodes)
     {
-        for(sprites_manager_item& item : layer.items())
-        {
-            if(item.camera)
-            {
-                item.update_hw_position();
+        sprites_manager_item& item = sprites_manager_item::camera_attach_node_item(attached_node);
+        item.update_hw_position();
 
-                if(item.visible)
-                {
-                    item.check_on_screen = true;
-                    check_items_on_screen = true;
-                }
-            }
+        if(item.visible)
+        {
+            item.check_on_screen = true;
+            check_items_on_screen = true;
         }
     }
 
@@ -351,6 +351,11 @@ void decrease_usages(id_type id)
             sprite_affine_mats_manager::dettach_sprite(item_affine_mat->id(), item->affine_mat_attach_node);
         }
 
+        if(const camera_ptr* item_camera = item->camera.get())
+        {
+            cameras_manager::dettach_sprite(item_camera->id(), item->camera_attach_node);
+        }
+
         if(item->visible)
         {
             hw::sprites::hide_and_destroy(item->handle);
@@ -741,7 +746,9 @@ void set_horizontal_flip(id_type id, bool horizontal_flip)
 
     if(sprite_affine_mat_ptr* item_affine_mat = item->affine_mat.get())
     {
-        item_affine_mat->set_horizontal_flip(horizontal_flip);
+        affine_mat_attributes mat_attributes = item_affine_mat->attributes();
+        mat_attributes.set_horizontal_flip(horizontal_flip);
+        set_affine_mat_attributes(id, mat_attributes);
     }
     else
     {
@@ -773,7 +780,9 @@ void set_vertical_flip(id_type id, bool vertical_flip)
 
     if(sprite_affine_mat_ptr* item_affine_mat = item->affine_mat.get())
     {
-        item_affine_mat->set_vertical_flip(vertical_flip);
+        affine_mat_attributes mat_attributes = item_affine_mat->attributes();
+        mat_attributes.set_vertical_flip(vertical_flip);
+        set_affine_mat_attributes(id, mat_attributes);
     }
     else
     {
@@ -934,6 +943,12 @@ void set_camera(id_type id, camera_ptr&& camera)
 
     if(camera != item->camera)
     {
+        if(const camera_ptr* item_camera = item->camera.get())
+        {
+            cameras_manager::dettach_sprite(item_camera->id(), item->camera_attach_node);
+        }
+
+        cameras_manager::attach_sprite(camera.id(), item->camera_attach_node);
         item->camera = move(camera);
         item->update_hw_position();
 
@@ -950,8 +965,9 @@ void remove_camera(id_type id)
 {
     auto item = static_cast<item_type*>(id);
 
-    if(item->camera)
+    if(const camera_ptr* item_camera = item->camera.get())
     {
+        cameras_manager::dettach_sprite(item_camera->id(), item->camera_attach_node);
         item->camera.reset();
         item->update_hw_position();
 
@@ -996,7 +1012,31 @@ void set_new_affine_mat(id_type id, affine_mat_attributes& mat_attributes)
     const hw::sprites::handle_type& handle = item->handle;
     mat_attributes.set_horizontal_flip(hw::sprites::horizontal_flip(handle));
     mat_attributes.set_vertical_flip(hw::sprites::vertical_flip(handle));
-    _assign_affine_mat(true, *item, sprite_affine_mat_ptr::create(mat_attributes));
+
+    if(sprite_affine_mats_manager::shared_by_default())
+    {
+        _assign_affine_mat(true, *item, sprite_affine_mat_ptr::create_shared(mat_attributes));
+    }
+    else
+    {
+        _assign_affine_mat(true, *item, sprite_affine_mat_ptr::create(mat_attributes));
+    }
+}
+
+void set_affine_mat_attributes(id_type id, const affine_mat_attributes& mat_attributes)
+{
+    auto item = static_cast<item_type*>(id);
+    sprite_affine_mat_ptr& item_affine_mat = *item->affine_mat;
+
+    if(! item_affine_mat.shared())
+    {
+        item_affine_mat.set_attributes(mat_attributes);
+    }
+    else if(! sprite_affine_mats_manager::set_shared_attributes(item_affine_mat.id(), mat_attributes))
+    {
+        _assign_affine_mat(item->remove_affine_mat_when_not_needed, *item,
+                           sprite_affine_mat_ptr::create_shared(mat_attributes));
+    }
 }
 
 void remove_affine_mat(id_type id)
@@ -1153,6 +1193,26 @@ void reload_blending()
     }
 }
 
+void reload_tiles()
+{
+    for(sorted_sprites::layer& layer : data.sorter.layers())
+    {
+        for(item_type& item : layer.items())
+        {
+            if(const sprite_tiles_ptr* tiles = item.tiles.get())
+            {
+                int tiles_id = tiles->id();
+
+                if(hw::sprites::tiles_id(item.handle) != tiles_id)
+                {
+                    hw::sprites::set_tiles(tiles_id, item.handle);
+                    _update_indexes_to_commit(item);
+                }
+            }
+        }
+    }
+}
+
 void reload_all()
 {
     data.last_visible_items_count = hw::sprites::count();
@@ -1322,9 +1382,9 @@ void fill_hblank_effect_third_attributes([[maybe_unused]] sprite_shape_size shap
     }
 }
 
-void update_cameras()
+void update_camera(intrusive_list<camera_attach_node_type>& attached_nodes)
 {
-    if(_update_cameras_impl(data.sorter.layers()))
+    if(_update_camera_impl(attached_nodes))
     {
         data.check_items_on_screen = true;
         data.rebuild_handles = true;
@@ -32,6 +32,8 @@ enum class sprite_size : uint8_t;
 enum class sprite_shape : uint8_t;
 enum class sprite_double_size_mode : uint8_t;
 
+using camera_attach_node_type = intrusive_list_node_type;
+
 namespace sorted_sprites
 {
     class layer;
@@ -162,6 +164,8 @@ namespace sprites_manager
 
     void set_new_affine_mat(id_type id, affine_mat_attributes& mat_attributes);
 
+    void set_affine_mat_attributes(id_type id, const affine_mat_attributes& mat_attributes);
+
     void remove_affine_mat(id_type id);
 
     [[nodiscard]] bool remove_affine_mat_when_not_needed(id_type id);
@@ -192,6 +196,8 @@ namespace sprites_manager
 
     void reload_blending();
 
+    void reload_tiles();
+
     void reload_all();
 
     void fill_hblank_effect_horizontal_positions(id_type id, int hw_x, const fixed* positions_ptr, uint16_t* dest_ptr);
@@ -212,7 +218,7 @@ namespace sprites_manager
     void fill_hblank_effect_third_attributes(
             sprite_shape_size shape_size, const sprite_third_attributes* third_attributes_ptr, uint16_t* dest_ptr);
 
-    void update_cameras();
+    void update_camera(intrusive_list<camera_attach_node_type>& attached_nodes);
 
     void remove_identity_affine_mat_when_not_needed(id_type id);
 
@@ -227,7 +233,7 @@ namespace sprites_manager
     [[nodiscard]] BN_CODE_IWRAM int _rebuild_handles_impl(
             int reserved_handles_count, void* hw_handles, intrusive_list<sorted_sprites::layer>& layers);
 
-    [[nodiscard]] BN_CODE_IWRAM bool _update_cameras_impl(intrusive_list<sorted_sprites::layer>& layers);
+    [[nodiscard]] BN_CODE_IWRAM bool _update_camera_impl(intrusive_list<camera_attach_node_type>& attached_nodes);
 }
 
 }
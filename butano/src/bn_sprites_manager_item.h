@@ -10,6 +10,7 @@
 #include "bn_sort_key.h"
 #include "bn_camera_ptr.h"
 #include "bn_intrusive_list.h"
+#include "bn_cameras_manager.h"
 #include "bn_display_manager.h"
 #include "bn_sprites_manager.h"
 #include "bn_sprite_tiles_ptr.h"
@@ -38,6 +39,7 @@ class sprites_manager_item : public intrusive_list_node_type
 
 public:
     sprite_affine_mat_attach_node_type affine_mat_attach_node;
+    camera_attach_node_type camera_attach_node;
     hw::sprites::handle_type handle;
     fixed_point position;
     point hw_position;
@@ -69,6 +71,15 @@ public:
         return *item;
     }
 
+    [[nodiscard]] static sprites_manager_item& camera_attach_node_item(camera_attach_node_type& attach_node)
+    {
+        auto item_address = reinterpret_cast<intptr_t>(&attach_node);
+        item_address -= sizeof(intrusive_list_node_type) + sizeof(sprite_affine_mat_attach_node_type);
+
+        auto item = reinterpret_cast<sprites_manager_item*>(item_address);
+        return *item;
+    }
+
     sprites_manager_item(const fixed_point& _position, const sprite_shape_size& shape_size,
                          sprite_tiles_ptr&& _tiles, sprite_palette_ptr&& _palette) :
         position(_position),
@@ -255,6 +266,11 @@ private:
                                        display_manager::blending_fade_enabled(), handle);
         }
 
+        if(const camera_ptr* camera_ptr = camera.get())
+        {
+            cameras_manager::attach_sprite(camera_ptr->id(), camera_attach_node);
+        }
+
         update_half_dimensions();
     }
 };
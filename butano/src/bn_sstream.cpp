@@ -108,16 +108,20 @@ void ostringstream::append(const char* char_array_ptr, int char_array_size)
 
 void ostringstream::append(int value)
 {
-    array<char, 32> buffer;
-    int size = hw::text::parse(value, buffer);
-    _string->append(buffer.data(), size);
+    if(value < 0)
+    {
+        _string->push_back('-');
+        _append_digits(0U - unsigned(value), 1);
+    }
+    else
+    {
+        _append_digits(unsigned(value), 1);
+    }
 }
 
 void ostringstream::append(long value)
 {
-    array<char, 32> buffer;
-    int size = hw::text::parse(value, buffer);
-    _string->append(buffer.data(), size);
+    append(int(value));
 }
 
 void ostringstream::append(int64_t value)
@@ -129,16 +133,12 @@ void ostringstream::append(int64_t value)
 
 void ostringstream::append(unsigned value)
 {
-    array<char, 32> buffer;
-    int size = hw::text::parse(value, buffer);
-    _string->append(buffer.data(), size);
+    _append_digits(value, 1);
 }
 
 void ostringstream::append(unsigned long value)
 {
-    array<char, 32> buffer;
-    int size = hw::text::parse(value, buffer);
-    _string->append(buffer.data(), size);
+    _append_digits(unsigned(value), 1);
 }
 
 void ostringstream::append(uint64_t value)
@@ -162,6 +162,28 @@ void ostringstream::append(const void* ptr)
     }
 }
 
+void ostringstream::append_padded(int value, int digits_count)
+{
+    BN_ASSERT(digits_count >= 1 && digits_count <= 10, "Invalid digits count: ", digits_count);
+
+    if(value < 0)
+    {
+        _string->push_back('-');
+        _append_digits(0U - unsigned(value), digits_count);
+    }
+    else
+    {
+        _append_digits(unsigned(value), digits_count);
+    }
+}
+
+void ostringstream::append_padded(unsigned value, int digits_count)
+{
+    BN_ASSERT(digits_count >= 1 && digits_count <= 10, "Invalid digits count: ", digits_count);
+
+    _append_digits(value, digits_count);
+}
+
 void ostringstream::swap(ostringstream& other)
 {
     bn::swap(_string, other._string);
@@ -170,17 +192,50 @@ void ostringstream::swap(ostringstream& other)
 
 void ostringstream::_append_fraction(unsigned fraction_result, int fraction_digits)
 {
-    array<char, 32> buffer;
-    int fraction_size = hw::text::parse(fraction_result, buffer);
-    istring& string = *_string;
-    string.append('.');
+    _string->push_back('.');
+    _append_digits(fraction_result, fraction_digits);
+}
+
+void ostringstream::_append_fixed(int data, int precision, int decimals)
+{
+    BN_ASSERT(decimals >= 0 && decimals <= 9, "Invalid decimals: ", decimals);
+
+    unsigned abs_data;
 
-    for(int index = fraction_size; index < fraction_digits; ++index)
+    if(data < 0)
     {
-        string.append('0');
+        _string->push_back('-');
+        abs_data = 0U - unsigned(data);
     }
+    else
+    {
+        abs_data = unsigned(data);
+    }
+
+    _append_digits(abs_data >> precision, 1);
+
+    if(decimals)
+    {
+        unsigned fraction = abs_data & ((1U << precision) - 1);
+        unsigned zeros = 1;
 
-    string.append(buffer.data(), fraction_size);
+        for(int index = 0; index < decimals; ++index)
+        {
+            zeros *= 10;
+        }
+
+        _append_fraction(unsigned((uint64_t(fraction) * zeros) >> precision), decimals);
+    }
+}
+
+void ostringstream::_append_digits(unsigned value, int min_digits_count)
+{
+    // Digits are written directly in the managed string:
+    int digits_count = max(hw::text::digits_count(value), min_digits_count);
+    istring& string = *_string;
+    char* output = string.end();
+    string.append(digits_count, '0');
+    hw::text::write_digits(value, digits_count, output);
 }
 
 }
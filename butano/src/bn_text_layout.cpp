@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_text_layout.h"
+
+namespace bn
+{
+
+namespace
+{
+    [[nodiscard]] int _character_width(char character, const utf8_character& utf8_char,
+                                       const utf8_characters_map_ref& utf8_characters_map,
+                                       const int8_t* character_widths, int fixed_character_width)
+    {
+        if(! character_widths)
+        {
+            return fixed_character_width;
+        }
+
+        int graphics_index;
+
+        if(character <= '~')
+        {
+            graphics_index = character - '!';
+        }
+        else
+        {
+            graphics_index = utf8_characters_map.index(utf8_char) + sprite_font::minimum_graphics;
+        }
+
+        return character_widths[graphics_index + 1];
+    }
+
+    [[nodiscard]] int _line_x(int line_width, int box_width, text_layout::alignment_type alignment)
+    {
+        switch(alignment)
+        {
+
+        case text_layout::alignment_type::LEFT:
+            return 0;
+
+        case text_layout::alignment_type::CENTER:
+            return (box_width - line_width) / 2;
+
+        case text_layout::alignment_type::RIGHT:
+            return box_width - line_width;
+
+        default:
+            BN_ERROR("Invalid alignment: ", int(alignment));
+            return 0;
+        }
+    }
+}
+
+text_layout::text_layout(const sprite_font& font, const string_view& text, int box_width,
+                         alignment_type alignment) :
+    _font(font),
+    _text(text),
+    _box_width(int16_t(box_width)),
+    _alignment(alignment)
+{
+    BN_ASSERT(box_width > 0, "Invalid box width: ", box_width);
+
+    const utf8_characters_map_ref& utf8_characters_map = font.utf8_characters_ref();
+    const int8_t* character_widths = font.character_widths_ref().data();
+    int fixed_character_width = font.item().shape_size().width();
+    int space_between_characters = font.space_between_characters();
+    int space_width = character_widths ? character_widths[0] : fixed_character_width;
+    const char* text_data = text.data();
+    int text_size = text.size();
+    int text_index = 0;
+    int characters_count = 0;
+    int lines_count = 0;
+    int line_characters_position = 0;
+    int line_text_position = 0;
+    int line_width = 0;
+    int break_character_index = -1;
+    int break_width = 0;
+
+    auto add_line = [&](int characters_end, int text_end, int width)
+    {
+        BN_ASSERT(lines_count < max_lines, "Too many lines: ", text);
+
+        line_type& line = _lines[lines_count];
+        line.text_position = int16_t(line_text_position);
+        line.text_size = int16_t(text_end - line_text_position);
+        line.characters_position = int16_t(line_characters_position);
+        line.characters_count = int16_t(characters_end - line_characters_position);
+        line.x = int16_t(_line_x(width, box_width, alignment));
+        line.width = int16_t(width);
+        ++lines_count;
+    };
+
+    while(text_index < text_size)
+    {
+        BN_ASSERT(characters_count < max_characters, "Too many characters: ", text);
+
+        char character = text_data[text_index];
+        utf8_character utf8_char(text_data[text_index]);
+        int character_size = utf8_char.size();
+
+        if(character == '\n')
+        {
+            add_line(characters_count, text_index, line_width);
+            _character_lines[characters_count] = uint8_t(lines_count - 1);
+            text_index += character_size;
+            _character_ends[characters_count] = int16_t(text_index);
+            ++characters_count;
+            line_characters_position = characters_count;
+            line_text_position = text_index;
+            line_width = 0;
+            break_character_index = -1;
+            continue;
+        }
+
+        int advance;
+
+        if(character == ' ')
+        {
+            advance = space_width + space_between_characters;
+        }
+        else if(character == '\t')
+        {
+            advance = (space_width * 4) + space_between_characters;
+        }
+        else
+        {
+            BN_ASSERT(character >= '!', "Invalid character: ", character, " (text: ", text, ")");
+
+            int width = _character_width(character, utf8_char, utf8_characters_map, character_widths,
+                                         fixed_character_width);
+
+            if(line_width + width > box_width && characters_count > line_characters_position &&
+                    break_character_index >= 0)
+            {
+                // Break the line in the last space:
+                int break_text_position = break_character_index ? _character_ends[break_character_index - 1] : 0;
+                add_line(break_character_index, break_text_position, break_width);
+                line_characters_position = break_character_index + 1;
+                line_text_position = _character_ends[break_character_index];
+                line_width -= break_width + space_width + space_between_characters;
+                break_character_index = -1;
+
+                for(int index = line_characters_position; index < characters_count; ++index)
+                {
+                    _character_lines[index] = uint8_t(lines_count);
+                }
+            }
+
+            if(line_width + width > box_width && characters_count > line_characters_position)
+            {
+                // Break the line before the current character:
+                add_line(characters_count, text_index, line_width);
+                line_characters_position = characters_count;
+                line_text_position = text_index;
+                line_width = 0;
+                break_character_index = -1;
+            }
+
+            advance = width + space_between_characters;
+        }
+
+        if(character == ' ')
+        {
+            break_character_index = characters_count;
+            break_width = line_width;
+        }
+
+        _character_lines[characters_count] = uint8_t(lines_count);
+        text_index += character_size;
+        _character_ends[characters_count] = int16_t(text_index);
+        line_width += advance;
+        ++characters_count;
+    }
+
+    add_line(characters_count, text_index, line_width);
+    _characters_count = int16_t(characters_count);
+    _lines_count = int8_t(lines_count);
+}
+
+string_view text_layout::line_text(int line_index, int characters_count) const
+{
+    BN_ASSERT(line_index >= 0 && line_index < _lines_count, "Invalid line index: ", line_index);
+    BN_ASSERT(characters_count >= 0, "Invalid characters count: ", characters_count);
+
+    const line_type& line = _lines[line_index];
+    int line_characters_count = min(characters_count, int(line.characters_count));
+    int text_size = line_characters_count ?
+                _character_ends[line.characters_position + line_characters_count - 1] - line.text_position : 0;
+    return string_view(_text.data() + line.text_position, text_size);
+}
+
+}
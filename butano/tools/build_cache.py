@@ -0,0 +1,147 @@
+"""
+Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+zlib License, see LICENSE file.
+"""
+
+import hashlib
+import json
+import os
+import shutil
+import tempfile
+
+
+class BuildCache:
+    """
+    Decides if an asset must be processed again by hashing the contents of its input files instead of checking
+    modification times, so checkouts, branch switches and restored CI caches don't trigger rebuilds.
+
+    Each asset has a file info file in the build folder which stores the hash of its inputs and its output files.
+    If a shared cache folder is provided, output files are also stored there indexed by the inputs hash,
+    so they can be reused by other build folders (other projects, other machines, clean builds, etc).
+    """
+
+    def __init__(self, build_folder_path, shared_folder_path, tool_file_paths, tool_executables=()):
+        self.build_folder_path = build_folder_path
+        self.shared_folder_path = shared_folder_path if shared_folder_path else None
+        tool_file_paths = list(tool_file_paths)
+        tool_items = []
+
+        # External tools (like grit) are hashed too, so updating them triggers rebuilds:
+        for tool_executable in tool_executables:
+            tool_executable_path = shutil.which(tool_executable)
+
+            if tool_executable_path is None:
+                tool_items.append(tool_executable)
+            else:
+                tool_file_paths.append(tool_executable_path)
+
+        self.__tool_hash = BuildCache.files_hash(tool_file_paths, tool_items)
+        self.local_hits = 0
+        self.shared_hits = 0
+        self.misses = 0
+
+    @staticmethod
+    def files_hash(file_paths, extra_items):
+        hasher = hashlib.sha1()
+
+        for extra_item in extra_items:
+            hasher.update(str(extra_item).encode())
+            hasher.update(b'\0')
+
+        for file_path in file_paths:
+            hasher.update(os.path.basename(file_path).encode())
+            hasher.update(b'\0')
+
+            with open(file_path, 'rb') as file:
+                hasher.update(file.read())
+
+        return hasher.hexdigest()
+
+    def inputs_hash(self, file_paths, extra_items=()):
+        return BuildCache.files_hash(file_paths, [self.__tool_hash] + list(extra_items))
+
+    @staticmethod
+    def __read_file_info(file_info_path):
+        try:
+            with open(file_info_path, 'r') as file_info:
+                return json.load(file_info)
+        except Exception:
+            return None
+
+    @staticmethod
+    def write_file_info(file_info_path, inputs_hash, output_file_paths, result):
+        with open(file_info_path, 'w') as file_info:
+            json.dump({
+                'inputs_hash': inputs_hash,
+                'output_files': [os.path.basename(output_file_path) for output_file_path in output_file_paths],
+                'result': result,
+            }, file_info)
+
+    def lookup(self, file_info_path, inputs_hash):
+        """
+        Returns the stored result of the asset if its output files are up to date or could be restored
+        from the shared cache folder; None otherwise.
+        """
+
+        file_info = BuildCache.__read_file_info(file_info_path)
+
+        if file_info is not None and file_info.get('inputs_hash') == inputs_hash:
+            output_file_names = file_info['output_files']
+
+            if all(os.path.isfile(os.path.join(self.build_folder_path, name)) for name in output_file_names):
+                self.local_hits += 1
+                return file_info['result']
+
+        if self.shared_folder_path is not None:
+            shared_entry_path = os.path.join(self.shared_folder_path, inputs_hash)
+            shared_file_info = BuildCache.__read_file_info(os.path.join(shared_entry_path, 'file_info.json'))
+
+            if shared_file_info is not None:
+                output_file_names = shared_file_info['output_files']
+
+                for output_file_name in output_file_names:
+                    shutil.copyfile(os.path.join(shared_entry_path, output_file_name),
+                                    os.path.join(self.build_folder_path, output_file_name))
+
+                shutil.copyfile(os.path.join(shared_entry_path, 'file_info.json'), file_info_path)
+                self.shared_hits += 1
+                return shared_file_info['result']
+
+        self.misses += 1
+        return None
+
+    def store(self, file_info_path, inputs_hash, output_file_paths, result):
+        BuildCache.write_file_info(file_info_path, inputs_hash, output_file_paths, result)
+        BuildCache.store_shared(self.shared_folder_path, file_info_path, inputs_hash, output_file_paths)
+
+    @staticmethod
+    def store_shared(shared_folder_path, file_info_path, inputs_hash, output_file_paths):
+        if shared_folder_path is None:
+            return
+
+        shared_entry_path = os.path.join(shared_folder_path, inputs_hash)
+
+        if os.path.isdir(shared_entry_path):
+            return
+
+        # Entries are written in a temporary folder and then renamed,
+        # so other builds sharing the same cache folder never find incomplete entries:
+        os.makedirs(shared_folder_path, exist_ok=True)
+        temp_entry_path = tempfile.mkdtemp(dir=shared_folder_path, prefix='.tmp_')
+
+        try:
+            for output_file_path in output_file_paths:
+                shutil.copyfile(output_file_path, os.path.join(temp_entry_path, os.path.basename(output_file_path)))
+
+            shutil.copyfile(file_info_path, os.path.join(temp_entry_path, 'file_info.json'))
+            os.rename(temp_entry_path, shared_entry_path)
+        except OSError:
+            shutil.rmtree(temp_entry_path, ignore_errors=True)
+
+    def print_hit_rate(self, tag):
+        total = self.local_hits + self.shared_hits + self.misses
+
+        if total > 0:
+            hits = self.local_hits + self.shared_hits
+            print('    ' + tag + ' build cache: ' + str(self.local_hits) + ' local hits, ' + str(self.shared_hits) +
+                  ' shared hits, ' + str(self.misses) + ' misses (hit rate: ' + str(hits * 100 // total) + '%)')
@@ -15,12 +15,13 @@ if __name__ == "__main__":
     parser.add_argument('--dmg_audio', required=True, help='dmg audio folder and file paths')
     parser.add_argument('--graphics', required=True, help='graphics folder and file paths')
     parser.add_argument('--build', required=True, help='build folder path')
+    parser.add_argument('--cache', default='', help='shared processed graphics and DMG audio files folder path')
 
     try:
         args = parser.parse_args()
         process_audio(args.mmutil, args.audio, args.build)
-        process_dmg_audio(args.dmg_audio, args.build)
-        process_graphics(args.grit, args.graphics, args.build)
+        process_dmg_audio(args.dmg_audio, args.build, args.cache)
+        process_graphics(args.grit, args.graphics, args.build, args.cache)
     except Exception as ex:
         sys.stderr.write('Error: ' + str(ex) + '\n')
         traceback.print_exc()
@@ -4,6 +4,7 @@ zlib License, see LICENSE file.
 """
 
 import os
+import shutil
 import subprocess
 import sys
 
@@ -175,7 +176,17 @@ def process_audio(mmutil, audio_paths, build_folder_path):
     audio_file_names, audio_file_names_no_ext, audio_file_paths = list_audio_files(audio_paths)
     file_info_path = build_folder_path + '/_bn_audio_files_info.txt'
     old_file_info = FileInfo.read(file_info_path)
-    new_file_info = FileInfo.build_from_files(audio_file_paths)
+
+    # Tool sources and mmutil are hashed too, so updating them triggers rebuilds:
+    tools_folder_path = os.path.dirname(os.path.abspath(__file__))
+    input_file_paths = audio_file_paths + [os.path.join(tools_folder_path, 'butano_audio_tool.py'),
+                                           os.path.join(tools_folder_path, 'file_info.py')]
+    mmutil_path = shutil.which(mmutil)
+
+    if mmutil_path is not None:
+        input_file_paths.append(mmutil_path)
+
+    new_file_info = FileInfo.build_from_files(input_file_paths)
 
     if old_file_info == new_file_info:
         return
@@ -9,24 +9,28 @@ import sys
 from multiprocessing import Pool
 
 from file_info import FileInfo
+from build_cache import BuildCache
 
 
 class DmgAudioFileInfo:
 
-    def __init__(self, json_file_path, file_path, file_name, file_name_no_ext, file_name_ext, file_info_path):
+    def __init__(self, json_file_path, file_path, file_name, file_name_no_ext, file_name_ext, file_info_path,
+                 inputs_hash):
         self.__json_file_path = json_file_path
         self.__file_path = file_path
         self.__file_name = file_name
         self.__file_name_no_ext = file_name_no_ext
         self.__file_name_ext = file_name_ext
         self.__file_info_path = file_info_path
+        self.__inputs_hash = inputs_hash
         self.__import_instruments = False
         self.__mod_speed_conversion = True
 
     def print_file_name(self):
         print(self.__file_name)
 
-    def process(self, build_folder_path):
+    def process(self, build_cache):
+        build_folder_path = build_cache.build_folder_path
         output_tag = self.__file_name_no_ext + '_bn_dmg'
         output_file_name = output_tag + '.c'
         output_file_path = build_folder_path + '/' + output_file_name
@@ -62,9 +66,8 @@ class DmgAudioFileInfo:
                 music_type = 'VGM'
 
             header_file_path = self.__write_header(build_folder_path, output_tag, music_type)
-
-            with open(self.__file_info_path, 'w') as file_info:
-                file_info.write('')
+            build_cache.store(self.__file_info_path, self.__inputs_hash, [output_file_path, header_file_path],
+                              file_size)
 
             return [self.__file_name, header_file_path, file_size]
         except Exception as exc:
@@ -159,14 +162,15 @@ class DmgAudioFileInfo:
 
 class DmgAudioFileInfoProcessor:
 
-    def __init__(self, build_folder_path):
-        self.__build_folder_path = build_folder_path
+    def __init__(self, build_cache):
+        self.__build_cache = build_cache
 
     def __call__(self, audio_file_info):
-        return audio_file_info.process(self.__build_folder_path)
+        return audio_file_info.process(self.__build_cache)
 
 
-def list_dmg_audio_file_infos(audio_paths, build_folder_path):
+def list_dmg_audio_file_infos(audio_paths, build_cache):
+    build_folder_path = build_cache.build_folder_path
     audio_file_paths = []
 
     for audio_path in audio_paths.split(' '):
@@ -211,30 +215,32 @@ def list_dmg_audio_file_infos(audio_paths, build_folder_path):
                 else:
                     file_info_path += '_dmg_audio_without_json_file_info.txt'
 
-                if not os.path.exists(file_info_path):
-                    build = True
+                if json_file_path is not None:
+                    inputs_hash = build_cache.inputs_hash([audio_file_path, json_file_path])
                 else:
-                    file_info_mtime = os.path.getmtime(file_info_path)
-                    audio_file_mtime = os.path.getmtime(audio_file_path)
-                    build = file_info_mtime < audio_file_mtime
+                    inputs_hash = build_cache.inputs_hash([audio_file_path])
 
-                    if not build and json_file_path is not None:
-                        json_file_mtime = os.path.getmtime(json_file_path)
-                        build = file_info_mtime < json_file_mtime
-
-                if build:
+                if build_cache.lookup(file_info_path, inputs_hash) is None:
                     audio_file_infos.append(DmgAudioFileInfo(
                         json_file_path, audio_file_path, audio_file_name, audio_file_name_no_ext, audio_file_name_ext,
-                        file_info_path))
+                        file_info_path, inputs_hash))
 
     return audio_file_infos
 
 
-def process_dmg_audio(audio_paths, build_folder_path):
+def process_dmg_audio(audio_paths, build_folder_path, cache_folder_path=None):
     if len(audio_paths) == 0:
         return
 
-    audio_file_infos = list_dmg_audio_file_infos(audio_paths, build_folder_path)
+    tools_folder_path = os.path.dirname(os.path.abspath(__file__))
+    tool_file_paths = [os.path.join(tools_folder_path, 'butano_dmg_audio_tool.py'),
+                       os.path.join(tools_folder_path, 'mod2gbt', 'mod2gbt.py'),
+                       os.path.join(tools_folder_path, 's3m2gbt', 's3m2gbt.py'),
+                       os.path.join(tools_folder_path, 'vgm2gba', 'vgm2gba.py'),
+                       os.path.join(tools_folder_path, 'build_cache.py'),
+                       os.path.join(tools_folder_path, 'file_info.py')]
+    build_cache = BuildCache(build_folder_path, cache_folder_path, tool_file_paths)
+    audio_file_infos = list_dmg_audio_file_infos(audio_paths, build_cache)
 
     if len(audio_file_infos) > 0:
         for audio_file_info in audio_file_infos:
@@ -243,7 +249,7 @@ def process_dmg_audio(audio_paths, build_folder_path):
         sys.stdout.flush()
 
         pool = Pool()
-        process_results = pool.map(DmgAudioFileInfoProcessor(build_folder_path), audio_file_infos)
+        process_results = pool.map(DmgAudioFileInfoProcessor(build_cache), audio_file_infos)
         pool.close()
 
         process_excs = []
@@ -267,3 +273,5 @@ def process_dmg_audio(audio_paths, build_folder_path):
                 sys.stderr.write(str(process_exc[0]) + ' error: ' + str(process_exc[1]) + '\n')
 
             exit(-1)
+
+    build_cache.print_hit_rate('DMG audio')
@@ -13,6 +13,8 @@ from multiprocessing import Pool
 
 from bmp import BMP
 from file_info import FileInfo
+from build_cache import BuildCache
+from gba_compression import compressed_size
 
 
 def parse_colors_count(info, bmp, tag='colors_count'):
@@ -63,20 +65,28 @@ def parse_bg_bpp_mode(info, file_name_no_ext):
         raise ValueError('Invalid BPP mode: ' + bpp_mode)
 
 
-def validate_palette_item(palette_item):
-    if len(palette_item) == 0:
-        raise ValueError('Empty palette item')
+def validate_item_name(item_name, tag):
+    if len(item_name) == 0:
+        raise ValueError('Empty ' + tag)
 
-    if palette_item[0] not in string.ascii_lowercase:
-        raise ValueError('Invalid palette item: ' + palette_item +
-                         ' (invalid character: \'' + palette_item[0] + '\')')
+    if item_name[0] not in string.ascii_lowercase:
+        raise ValueError('Invalid ' + tag + ': ' + item_name +
+                         ' (invalid character: \'' + item_name[0] + '\')')
 
     valid_characters = '_%s%s' % (string.ascii_lowercase, string.digits)
 
-    for palette_item_character in palette_item:
-        if palette_item_character not in valid_characters:
-            raise ValueError('Invalid palette item: ' + palette_item +
-                             ' (invalid character: \'' + palette_item_character + '\')')
+    for item_name_character in item_name:
+        if item_name_character not in valid_characters:
+            raise ValueError('Invalid ' + tag + ': ' + item_name +
+                             ' (invalid character: \'' + item_name_character + '\')')
+
+
+def validate_palette_item(palette_item):
+    validate_item_name(palette_item, 'palette item')
+
+
+def validate_tiles_group(tiles_group):
+    validate_item_name(tiles_group, 'tiles group')
 
 
 def validate_compression(compression):
@@ -109,6 +119,161 @@ def append_compression_command(tag, compression, command):
         command.append('-' + tag + 'zh')
 
 
+def read_grit_array(grit_assembly_file_path, array_name):
+    # grit headers only declare arrays, their contents are in the assembly file:
+    with open(grit_assembly_file_path, 'r', encoding='latin-1') as grit_assembly_file:
+        grit_assembly_lines = grit_assembly_file.read().splitlines()
+
+    data_sizes = {'byte': 1, 'hword': 2, 'word': 4}
+    label = array_name + ':'
+    result = None
+
+    for grit_assembly_line in grit_assembly_lines:
+        grit_assembly_line = grit_assembly_line.strip()
+
+        if result is None:
+            if grit_assembly_line == label:
+                result = bytearray()
+        else:
+            # grit writes a blank line every 8 data lines:
+            if len(grit_assembly_line) == 0 or grit_assembly_line.startswith('@'):
+                continue
+
+            data_match = re.match(r'\.(byte|hword|word)\s+([^@]*)', grit_assembly_line)
+
+            if data_match is None:
+                # Next label or directive:
+                break
+
+            data_size = data_sizes[data_match.group(1)]
+            data_mask = (1 << (data_size * 8)) - 1
+
+            for value in data_match.group(2).split(','):
+                result += (int(value.strip(), 0) & data_mask).to_bytes(data_size, 'little')
+
+    if result is None:
+        raise ValueError('Array not found: ' + array_name)
+
+    return bytes(result)
+
+
+def write_grit_assembly(grit_assembly_file_path, block_name, arrays):
+    # Writes the given (name, data) arrays with the same layout as grit assembly files:
+    with open(grit_assembly_file_path, 'w') as grit_assembly_file:
+        grit_assembly_file.write('@{{BLOCK(' + block_name + ')\n')
+
+        for array_name, array_data in arrays:
+            words = [int.from_bytes(array_data[index:index + 4], 'little') for index in range(0, len(array_data), 4)]
+            grit_assembly_file.write('\n')
+            grit_assembly_file.write('\t.section .rodata\n')
+            grit_assembly_file.write('\t.align\t2\n')
+            grit_assembly_file.write('\t.global ' + array_name + '\t\t@ ' + str(len(array_data)) + ' unsigned chars\n')
+            grit_assembly_file.write('\t.hidden ' + array_name + '\n')
+            grit_assembly_file.write(array_name + ':\n')
+
+            for index in range(0, len(words), 8):
+                grit_assembly_file.write('\t.word ' + ','.join('0x%08X' % word for word in words[index:index + 8]) +
+                                         '\n')
+
+        grit_assembly_file.write('\n')
+        grit_assembly_file.write('@}}BLOCK(' + block_name + ')\n')
+
+
+_nibbles_swap_table = bytes(((value & 0xF) << 4) | (value >> 4) for value in range(256))
+
+
+def flip_tile(tile_data, bpp_8, horizontal_flip, vertical_flip):
+    row_size = 8 if bpp_8 else 4
+    rows = [tile_data[index:index + row_size] for index in range(0, len(tile_data), row_size)]
+
+    if horizontal_flip:
+        if bpp_8:
+            rows = [row[::-1] for row in rows]
+        else:
+            # 4BPP rows store two pixels per byte, left pixel in the low nibble:
+            rows = [row[::-1].translate(_nibbles_swap_table) for row in rows]
+
+    if vertical_flip:
+        rows.reverse()
+
+    return b''.join(rows)
+
+
+def colors_hash_argument(build_folder_path, name, colors_count, bpp_8, compression):
+    # Hashes of compressed palettes are calculated at runtime after decompression:
+    if bpp_8 or compression != 'none':
+        return ''
+
+    colors_data = read_grit_array(build_folder_path + '/' + name + '_bn_gfx.s', name + '_bn_gfxPal')
+    colors = [int.from_bytes(colors_data[index:index + 2], 'little') for index in range(0, len(colors_data), 2)]
+    colors = colors[:colors_count]
+
+    if len(colors) != colors_count or colors_count % 2:
+        raise ValueError('Invalid palette colors count: ' + str(len(colors)) + ' - ' + str(colors_count))
+
+    # FNV-1a over 32-bit words, the same hash calculated by palettes_bank::colors_hash:
+    colors_hash = 2166136261
+
+    for index in range(0, colors_count, 2):
+        colors_hash = ((colors_hash ^ (colors[index] | (colors[index + 1] << 16))) * 16777619) & 0xFFFFFFFF
+
+    return ', ' + hex(max(colors_hash, 1)) + 'U'
+
+
+def auto_compression(compression, data):
+    compressions = ['none', 'run_length', 'lz77']
+
+    if compression == 'auto':
+        compressions.append('huffman')
+
+    best_compression = None
+    best_size = None
+
+    for new_compression in compressions:
+        new_size = compressed_size(new_compression, data)
+
+        if best_size is None or new_size < best_size:
+            best_compression = new_compression
+            best_size = new_size
+
+    return best_compression
+
+
+def process_compressions(compressions, array_names, build_folder_path, name, execute_command):
+    # Auto compressions are selected from the sizes of the arrays compressed in memory,
+    # so grit is usually called at most twice instead of once per tested compression:
+    grit_assembly_file_path = build_folder_path + '/' + name + '_bn_gfx.s'
+    grit_compressions = ['none' if compression.startswith('auto') else compression for compression in compressions]
+    execute_command(*grit_compressions)
+    result = list(grit_compressions)
+    uncompressed_sizes = {}
+
+    for index, compression in enumerate(compressions):
+        if compression.startswith('auto'):
+            array_data = read_grit_array(grit_assembly_file_path, name + '_bn_gfx' + array_names[index])
+            result[index] = auto_compression(compression, array_data)
+            uncompressed_sizes[index] = compressed_size('none', array_data)
+
+    if result != grit_compressions:
+        execute_command(*result)
+
+        # Arrays bigger than the uncompressed ones after being compressed by grit are stored uncompressed:
+        fallback_result = list(result)
+
+        for index, uncompressed_size in uncompressed_sizes.items():
+            if result[index] != 'none':
+                array_data = read_grit_array(grit_assembly_file_path, name + '_bn_gfx' + array_names[index])
+
+                if len(array_data) > uncompressed_size:
+                    fallback_result[index] = 'none'
+
+        if fallback_result != result:
+            result = fallback_result
+            execute_command(*result)
+
+    return result
+
+
 def remove_file(file_path):
     if os.path.exists(file_path):
         os.remove(file_path)
@@ -216,54 +381,12 @@ class SpriteItem:
                 self.__palette_compression = 'none'
 
     def process(self, grit):
-        tiles_compression = self.__tiles_compression
-        palette_compression = self.__palette_compression
-
-        if tiles_compression.startswith('auto'):
-            test_huffman = tiles_compression == 'auto'
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'none', None)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'run_length',
-                                                                         file_size)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'lz77', file_size)
-
-            if test_huffman:
-                tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'huffman',
-                                                                             file_size)
-
-        if palette_compression.startswith('auto'):
-            test_huffman = palette_compression == 'auto'
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'none', None)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'run_length',
-                                                                             file_size)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'lz77',
-                                                                             file_size)
-
-            if test_huffman:
-                palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'huffman',
-                                                                                 file_size)
-
-        self.__execute_command(grit, tiles_compression, palette_compression)
-        return self.__write_header(tiles_compression, palette_compression, False)
-
-    def __test_tiles_compression(self, grit, best_tiles_compression, new_tiles_compression, best_file_size):
-        self.__execute_command(grit, new_tiles_compression, 'none')
-        new_file_size = self.__write_header(new_tiles_compression, 'none', True)
+        tiles_compression, palette_compression = process_compressions(
+            [self.__tiles_compression, self.__palette_compression], ['Tiles', 'Pal'], self.__build_folder_path,
+            self.__file_name_no_ext, lambda *compressions: self.__execute_command(grit, *compressions))
+        return self.__write_header(tiles_compression, palette_compression)
 
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_tiles_compression, new_file_size
-
-        return best_tiles_compression, best_file_size
-
-    def __test_palette_compression(self, grit, best_palette_compression, new_palette_compression, best_file_size):
-        self.__execute_command(grit, 'none', new_palette_compression)
-        new_file_size = self.__write_header('none', new_palette_compression, True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_palette_compression, new_file_size
-
-        return best_palette_compression, best_file_size
-
-    def __write_header(self, tiles_compression, palette_compression, skip_write):
+    def __write_header(self, tiles_compression, palette_compression):
         name = self.__file_name_no_ext
         grit_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.h'
         header_file_path = self.__build_folder_path + '/bn_sprite_items_' + name + '.h'
@@ -284,11 +407,7 @@ class SpriteItem:
 
                 if 'Total size:' in grit_line:
                     total_size = int(grit_line.split()[-1])
-
-                    if skip_write:
-                        return total_size
-                    else:
-                        break
+                    break
 
         remove_file(grit_file_path)
 
@@ -319,7 +438,10 @@ class SpriteItem:
                               ', ' + str(self.__graphics) + '), ' + '\n            ' +
                               'sprite_palette_item(span<const color>(' + name + '_bn_gfxPal, ' +
                               str(self.__colors_count) + '), ' + bpp_mode_label + ', ' +
-                              compression_label(palette_compression) + '));\n')
+                              compression_label(palette_compression) +
+                              colors_hash_argument(self.__build_folder_path, name, self.__colors_count, self.__bpp_8,
+                                                   palette_compression) +
+                              '));\n')
             header_file.write('}' + '\n')
             header_file.write('\n')
             header_file.write('#endif' + '\n')
@@ -381,30 +503,12 @@ class SpriteTilesItem:
             self.__compression = 'none'
 
     def process(self, grit):
-        compression = self.__compression
-
-        if compression.startswith('auto'):
-            test_huffman = compression == 'auto'
-            compression, file_size = self.__test_compression(grit, compression, 'none', None)
-            compression, file_size = self.__test_compression(grit, compression, 'run_length', file_size)
-            compression, file_size = self.__test_compression(grit, compression, 'lz77', file_size)
+        compression, = process_compressions(
+            [self.__compression], ['Tiles'], self.__build_folder_path, self.__file_name_no_ext,
+            lambda *compressions: self.__execute_command(grit, *compressions))
+        return self.__write_header(compression)
 
-            if test_huffman:
-                compression, file_size = self.__test_compression(grit, compression, 'huffman', file_size)
-
-        self.__execute_command(grit, compression)
-        return self.__write_header(compression, False)
-
-    def __test_compression(self, grit, best_compression, new_compression, best_file_size):
-        self.__execute_command(grit, new_compression)
-        new_file_size = self.__write_header(new_compression, True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_compression, new_file_size
-
-        return best_compression, best_file_size
-
-    def __write_header(self, compression, skip_write):
+    def __write_header(self, compression):
         name = self.__file_name_no_ext
         grit_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.h'
         header_file_path = self.__build_folder_path + '/bn_sprite_tiles_items_' + name + '.h'
@@ -424,11 +528,7 @@ class SpriteTilesItem:
 
                 if 'Total size:' in grit_line:
                     total_size = int(grit_line.split()[-1])
-
-                    if skip_write:
-                        return total_size
-                    else:
-                        break
+                    break
 
         remove_file(grit_file_path)
 
@@ -501,30 +601,12 @@ class SpritePaletteItem:
             self.__compression = 'none'
 
     def process(self, grit):
-        compression = self.__compression
-
-        if compression.startswith('auto'):
-            test_huffman = compression == 'auto'
-            compression, file_size = self.__test_compression(grit, compression, 'none', None)
-            compression, file_size = self.__test_compression(grit, compression, 'run_length', file_size)
-            compression, file_size = self.__test_compression(grit, compression, 'lz77', file_size)
-
-            if test_huffman:
-                compression, file_size = self.__test_compression(grit, compression, 'huffman', file_size)
+        compression, = process_compressions(
+            [self.__compression], ['Pal'], self.__build_folder_path, self.__file_name_no_ext,
+            lambda *compressions: self.__execute_command(grit, *compressions))
+        return self.__write_header(compression)
 
-        self.__execute_command(grit, compression)
-        return self.__write_header(compression, False)
-
-    def __test_compression(self, grit, best_compression, new_compression, best_file_size):
-        self.__execute_command(grit, new_compression)
-        new_file_size = self.__write_header(new_compression, True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_compression, new_file_size
-
-        return best_compression, best_file_size
-
-    def __write_header(self, compression, skip_write):
+    def __write_header(self, compression):
         name = self.__file_name_no_ext
         grit_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.h'
         header_file_path = self.__build_folder_path + '/bn_sprite_palette_items_' + name + '.h'
@@ -536,11 +618,7 @@ class SpritePaletteItem:
             for grit_line in grit_data.splitlines():
                 if 'Total size:' in grit_line:
                     total_size = int(grit_line.split()[-1])
-
-                    if skip_write:
-                        return total_size
-                    else:
-                        break
+                    break
 
         remove_file(grit_file_path)
 
@@ -564,7 +642,10 @@ class SpritePaletteItem:
             header_file.write('    constexpr inline sprite_palette_item ' + name + '(' +
                               'span<const color>(' + name + '_bn_gfxPal, ' +
                               str(self.__colors_count) + '), ' + '\n            ' +
-                              bpp_mode_label + ', ' + compression_label(compression) + ');' + '\n')
+                              bpp_mode_label + ', ' + compression_label(compression) +
+                              colors_hash_argument(self.__build_folder_path, name, self.__colors_count, self.__bpp_8,
+                                                   compression) +
+                              ');' + '\n')
             header_file.write('}' + '\n')
             header_file.write('\n')
             header_file.write('#endif' + '\n')
@@ -711,74 +792,132 @@ class RegularBgItem:
             except KeyError:
                 self.__map_compression = 'none'
 
+        try:
+            self.__tiles_group = str(info['tiles_group'])
+            validate_tiles_group(self.__tiles_group)
+
+            if self.__tiles_compression != 'none':
+                raise ValueError('Tiles compression not supported in tiles groups: ' + self.__tiles_compression)
+
+            if self.__map_compression != 'none':
+                raise ValueError('Map compression not supported in tiles groups: ' + self.__map_compression)
+        except KeyError:
+            self.__tiles_group = None
+
+        self.__tiles_group_palette_data = None
+        self.__tiles_group_palette_compression = None
+
+    def bpp_8(self):
+        return self.__bpp_8
+
+    def repeated_tiles_reduction(self):
+        return self.__repeated_tiles_reduction
+
+    def flipped_tiles_reduction(self):
+        return self.__flipped_tiles_reduction
+
     def process(self, grit):
-        tiles_compression = self.__tiles_compression
-        palette_compression = self.__palette_compression
-        map_compression = self.__map_compression
+        tiles_compression, palette_compression, map_compression = process_compressions(
+            [self.__tiles_compression, self.__palette_compression, self.__map_compression], ['Tiles', 'Pal', 'Map'],
+            self.__build_folder_path, self.__file_name_no_ext,
+            lambda *compressions: self.__execute_command(grit, *compressions))
+        return self.__write_header(tiles_compression, palette_compression, map_compression)
+
+    def process_tiles_group_member(self, grit):
+        # Tiles and map are generated uncompressed, since they are rewritten by the tiles group:
+        tiles_compression, palette_compression, map_compression = process_compressions(
+            ['none', self.__palette_compression, 'none'], ['Tiles', 'Pal', 'Map'], self.__build_folder_path,
+            self.__file_name_no_ext, lambda *compressions: self.__execute_command(grit, *compressions))
+        name = self.__file_name_no_ext
+        grit_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.h'
+        grit_assembly_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.s'
+        tiles_count = None
+
+        with open(grit_file_path, 'r') as grit_file:
+            for grit_line in grit_file.read().splitlines():
+                if ' tiles ' in grit_line:
+                    for grit_word in grit_line.split():
+                        try:
+                            tiles_count = int(grit_word)
+                            break
+                        except ValueError:
+                            pass
 
-        if tiles_compression.startswith('auto'):
-            test_huffman = tiles_compression == 'auto'
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'none', None)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'run_length',
-                                                                         file_size)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'lz77', file_size)
+                    break
 
-            if test_huffman:
-                tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'huffman',
-                                                                             file_size)
+        remove_file(grit_file_path)
+        self.__tiles_group_palette_compression = palette_compression
 
-        if palette_compression.startswith('auto'):
-            test_huffman = palette_compression == 'auto'
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'none', None)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'run_length',
-                                                                             file_size)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'lz77',
-                                                                             file_size)
+        if tiles_count is None:
+            raise ValueError('Tiles count not found in grit header: ' + grit_file_path)
 
-            if test_huffman:
-                palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'huffman',
-                                                                                 file_size)
+        if self.__palette_item is None:
+            self.__tiles_group_palette_data = read_grit_array(grit_assembly_file_path, name + '_bn_gfxPal')
 
-        if map_compression.startswith('auto'):
-            test_huffman = map_compression == 'auto'
-            map_compression, file_size = self.__test_map_compression(grit, map_compression, 'none', None)
-            map_compression, file_size = self.__test_map_compression(grit, map_compression, 'run_length', file_size)
-            map_compression, file_size = self.__test_map_compression(grit, map_compression, 'lz77', file_size)
+        tiles_data = read_grit_array(grit_assembly_file_path, name + '_bn_gfxTiles')
+        map_data = read_grit_array(grit_assembly_file_path, name + '_bn_gfxMap')
+        tile_size = 64 if self.__bpp_8 else 32
 
-            if test_huffman:
-                map_compression, file_size = self.__test_map_compression(grit, map_compression, 'huffman', file_size)
+        if len(tiles_data) != tiles_count * tile_size:
+            raise ValueError('Invalid grit tiles data size: ' + str(len(tiles_data)) + ' (expected: ' +
+                             str(tiles_count * tile_size) + ')')
 
-        self.__execute_command(grit, tiles_compression, palette_compression, map_compression)
-        return self.__write_header(tiles_compression, palette_compression, map_compression, False)
+        map_size = self.__width * self.__height * self.__maps * 2
 
-    def __test_tiles_compression(self, grit, best_tiles_compression, new_tiles_compression, best_file_size):
-        self.__execute_command(grit, new_tiles_compression, 'none', 'none')
-        new_file_size = self.__write_header(new_tiles_compression, 'none', 'none', True)
+        if len(map_data) != map_size:
+            raise ValueError('Invalid grit map data size: ' + str(len(map_data)) + ' (expected: ' + str(map_size) +
+                             ')')
 
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_tiles_compression, new_file_size
+        return tiles_data, map_data
 
-        return best_tiles_compression, best_file_size
+    def write_tiles_group_member_header(self, map_data, tiles_group_arrays):
+        name = self.__file_name_no_ext
+        header_file_path = self.__build_folder_path + '/bn_regular_bg_items_' + name + '.h'
+        palette_data = self.__tiles_group_palette_data
+        arrays = tiles_group_arrays + [(name + '_bn_gfxMap', map_data)]
+        total_size = len(map_data)
 
-    def __test_palette_compression(self, grit, best_palette_compression, new_palette_compression, best_file_size):
-        self.__execute_command(grit, 'none', new_palette_compression, 'none')
-        new_file_size = self.__write_header('none', new_palette_compression, 'none', True)
+        if palette_data is not None:
+            arrays.append((name + '_bn_gfxPal', palette_data))
+            total_size += len(palette_data)
 
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_palette_compression, new_file_size
+        grit_assembly_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.s'
+        write_grit_assembly(grit_assembly_file_path, name + '_bn_gfx', arrays)
 
-        return best_palette_compression, best_file_size
+        with open(header_file_path, 'w') as header_file:
+            include_guard = 'BN_REGULAR_BG_ITEMS_' + name.upper() + '_H'
+            header_file.write('#ifndef ' + include_guard + '\n')
+            header_file.write('#define ' + include_guard + '\n')
+            header_file.write('\n')
+            header_file.write('#include "bn_regular_bg_item.h"' + '\n')
+            header_file.write('#include "bn_regular_bg_tiles_items_' + self.__tiles_group + '.h"' + '\n')
+            header_file.write('\n')
+            header_file.write('extern const bn::regular_bg_map_cell ' + name + '_bn_gfxMap[' +
+                              str(len(map_data) // 2) + '];' + '\n')
+
+            if palette_data is not None:
+                header_file.write('extern const bn::color ' + name + '_bn_gfxPal[' + str(self.__colors_count) + '];' +
+                                  '\n')
+
+            header_file.write('\n')
 
-    def __test_map_compression(self, grit, best_map_compression, new_map_compression, best_file_size):
-        self.__execute_command(grit, 'none', 'none', new_map_compression)
-        new_file_size = self.__write_header('none', 'none', new_map_compression, True)
+            if self.__palette_item is not None:
+                header_file.write('#include "bn_bg_palette_items_' + self.__palette_item + '.h"' + '\n')
+                header_file.write('\n')
 
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_map_compression, new_file_size
+            header_file.write('namespace bn::regular_bg_items' + '\n')
+            header_file.write('{' + '\n')
+            header_file.write('    constexpr inline regular_bg_item ' + name + '(' + '\n            ' +
+                              'bn::regular_bg_tiles_items::' + self.__tiles_group + ',' + '\n            ')
+            self.__write_palette_and_map_items(header_file, self.__tiles_group_palette_compression, 'none')
+            header_file.write('}' + '\n')
+            header_file.write('\n')
+            header_file.write('#endif' + '\n')
+            header_file.write('\n')
 
-        return best_map_compression, best_file_size
+        return total_size, [grit_assembly_file_path, header_file_path]
 
-    def __write_header(self, tiles_compression, palette_compression, map_compression, skip_write):
+    def __write_header(self, tiles_compression, palette_compression, map_compression):
         name = self.__file_name_no_ext
         grit_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.h'
         header_file_path = self.__build_folder_path + '/bn_regular_bg_items_' + name + '.h'
@@ -805,11 +944,7 @@ class RegularBgItem:
 
                 if 'Total size:' in grit_line:
                     total_size = int(grit_line.split()[-1])
-
-                    if skip_write:
-                        return total_size
-                    else:
-                        break
+                    break
 
         remove_file(grit_file_path)
 
@@ -842,17 +977,7 @@ class RegularBgItem:
                               str(tiles_count) + '), ' + bpp_mode_label + ', ' + compression_label(tiles_compression) +
                               '), ' + '\n            ')
 
-            if self.__palette_item is None:
-                header_file.write('bg_palette_item(span<const color>(' + name + '_bn_gfxPal, ' +
-                                  str(self.__colors_count) + '), ' + bpp_mode_label + ', ' +
-                                  compression_label(palette_compression) + '),' + '\n            ')
-            else:
-                header_file.write('bn::bg_palette_items::' + self.__palette_item + ',' + '\n            ')
-
-            header_file.write('regular_bg_map_item(' + name + '_bn_gfxMap[0], ' +
-                              'size(' + str(self.__width) + ', ' + str(self.__height) + '), ' +
-                              compression_label(map_compression) + ', ' + str(self.__maps) + ', ' +
-                              str(self.__big).lower() + '));' + '\n')
+            self.__write_palette_and_map_items(header_file, palette_compression, map_compression)
             header_file.write('}' + '\n')
             header_file.write('\n')
             header_file.write('#endif' + '\n')
@@ -860,6 +985,24 @@ class RegularBgItem:
 
         return total_size, header_file_path
 
+    def __write_palette_and_map_items(self, header_file, palette_compression, map_compression):
+        name = self.__file_name_no_ext
+
+        if self.__palette_item is None:
+            bpp_mode_label = 'bpp_mode::BPP_8' if self.__bpp_8 else 'bpp_mode::BPP_4'
+            header_file.write('bg_palette_item(span<const color>(' + name + '_bn_gfxPal, ' +
+                              str(self.__colors_count) + '), ' + bpp_mode_label + ', ' +
+                              compression_label(palette_compression) +
+                              colors_hash_argument(self.__build_folder_path, name, self.__colors_count,
+                                                   self.__bpp_8, palette_compression) + '),' + '\n            ')
+        else:
+            header_file.write('bn::bg_palette_items::' + self.__palette_item + ',' + '\n            ')
+
+        header_file.write('regular_bg_map_item(' + name + '_bn_gfxMap[0], ' +
+                          'size(' + str(self.__width) + ', ' + str(self.__height) + '), ' +
+                          compression_label(map_compression) + ', ' + str(self.__maps) + ', ' +
+                          str(self.__big).lower() + '));' + '\n')
+
     def __execute_command(self, grit, tiles_compression, palette_compression, map_compression):
         command = [grit, self.__file_path]
 
@@ -939,54 +1082,12 @@ class RegularBgTilesItem:
             self.__palette_compression = 'none'
 
     def process(self, grit):
-        tiles_compression = self.__tiles_compression
-        palette_compression = self.__palette_compression
-
-        if tiles_compression.startswith('auto'):
-            test_huffman = tiles_compression == 'auto'
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'none', None)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'run_length',
-                                                                         file_size)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'lz77', file_size)
-
-            if test_huffman:
-                tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'huffman',
-                                                                             file_size)
-
-        if palette_compression.startswith('auto'):
-            test_huffman = palette_compression == 'auto'
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'none', None)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'run_length',
-                                                                             file_size)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'lz77',
-                                                                             file_size)
+        tiles_compression, palette_compression = process_compressions(
+            [self.__tiles_compression, self.__palette_compression], ['Tiles', 'Pal'], self.__build_folder_path,
+            self.__file_name_no_ext, lambda *compressions: self.__execute_command(grit, *compressions))
+        return self.__write_header(tiles_compression, palette_compression)
 
-            if test_huffman:
-                palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'huffman',
-                                                                                 file_size)
-
-        self.__execute_command(grit, tiles_compression, palette_compression)
-        return self.__write_header(tiles_compression, palette_compression, False)
-
-    def __test_tiles_compression(self, grit, best_compression, new_compression, best_file_size):
-        self.__execute_command(grit, new_compression, 'none')
-        new_file_size = self.__write_header(new_compression, 'none', True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_compression, new_file_size
-
-        return best_compression, best_file_size
-
-    def __test_palette_compression(self, grit, best_compression, new_compression, best_file_size):
-        self.__execute_command(grit, 'none', new_compression)
-        new_file_size = self.__write_header('none', new_compression, True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_compression, new_file_size
-
-        return best_compression, best_file_size
-
-    def __write_header(self, tiles_compression, palette_compression, skip_write):
+    def __write_header(self, tiles_compression, palette_compression):
         name = self.__file_name_no_ext
         grit_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.h'
         header_file_path = self.__build_folder_path + '/bn_regular_bg_tiles_items_' + name + '.h'
@@ -1013,11 +1114,7 @@ class RegularBgTilesItem:
 
                 if 'Total size:' in grit_line:
                     total_size = int(grit_line.split()[-1])
-
-                    if skip_write:
-                        return total_size
-                    else:
-                        break
+                    break
 
         remove_file(grit_file_path)
 
@@ -1056,7 +1153,9 @@ class RegularBgTilesItem:
                 header_file.write('    constexpr inline bg_palette_item ' + name + '_palette(' +
                                   'span<const color>(' + name + '_bn_gfxPal, ' +
                                   str(self.__palette_colors_count) + '), ' + '\n            ' +
-                                  bpp_mode_label + ', ' + compression_label(palette_compression) + ');' + '\n')
+                                  bpp_mode_label + ', ' + compression_label(palette_compression) +
+                                  colors_hash_argument(self.__build_folder_path, name, self.__palette_colors_count,
+                                                       self.__bpp_8, palette_compression) + ');' + '\n')
 
             header_file.write('}' + '\n')
             header_file.write('\n')
@@ -1090,6 +1189,115 @@ class RegularBgTilesItem:
             raise ValueError(grit + ' call failed (return code ' + str(e.returncode) + '): ' + str(e.output))
 
 
+class RegularBgTilesGroup:
+
+    __flips = [(0x0000, False, False), (0x0400, True, False), (0x0800, False, True), (0x0C00, True, True)]
+
+    def __init__(self, name, items, build_folder_path):
+        self.__name = name
+        self.__items = items
+        self.__build_folder_path = build_folder_path
+        self.__bpp_8 = items[0].bpp_8()
+
+        for item in items:
+            if item.bpp_8() != self.__bpp_8:
+                raise ValueError('Regular BGs with different BPP modes found in tiles group: ' + name)
+
+    def process(self, grit):
+        tile_size = 64 if self.__bpp_8 else 32
+        tiles_data = bytearray()
+        tile_indexes = {}
+        items_map_data = []
+
+        for item in self.__items:
+            item_tiles_data, item_map_data = item.process_tiles_group_member(grit)
+            item_tile_cells = []
+
+            # Each tile of the item is replaced by an equal or flipped tile of the group if possible:
+            for tile_index in range(0, len(item_tiles_data), tile_size):
+                tile_data = item_tiles_data[tile_index:tile_index + tile_size]
+                tile_cell = None
+
+                if item.repeated_tiles_reduction():
+                    for flip_bits, horizontal_flip, vertical_flip in RegularBgTilesGroup.__flips:
+                        if flip_bits and not item.flipped_tiles_reduction():
+                            break
+
+                        flipped_tile_data = flip_tile(tile_data, self.__bpp_8, horizontal_flip, vertical_flip)
+                        group_tile_index = tile_indexes.get(flipped_tile_data)
+
+                        if group_tile_index is not None:
+                            tile_cell = group_tile_index | flip_bits
+                            break
+
+                if tile_cell is None:
+                    tile_cell = len(tiles_data) // tile_size
+                    tile_indexes.setdefault(tile_data, tile_cell)
+                    tiles_data += tile_data
+
+                item_tile_cells.append(tile_cell)
+
+            map_data = bytearray()
+
+            for cell_index in range(0, len(item_map_data), 2):
+                cell = int.from_bytes(item_map_data[cell_index:cell_index + 2], 'little')
+                tile_cell = item_tile_cells[cell & 0x03FF]
+                cell = (cell & 0xF000) | ((cell ^ tile_cell) & 0x0C00) | (tile_cell & 0x03FF)
+                map_data += cell.to_bytes(2, 'little')
+
+            items_map_data.append(map_data)
+
+        tiles_count = len(tiles_data) // tile_size
+
+        if tiles_count > 1024:
+            raise ValueError('Regular BG tiles groups with more than 1024 tiles not supported: ' + str(tiles_count))
+
+        if self.__bpp_8:
+            bpp_mode_label = 'bpp_mode::BPP_8'
+            tiles_count *= 2
+        else:
+            bpp_mode_label = 'bpp_mode::BPP_4'
+
+        # Group tiles are stored in the assembly file of the first item,
+        # since only assembly files generated from image files are built:
+        name = self.__name
+        tiles_group_arrays = [(name + '_bn_gfxTiles', tiles_data)]
+        total_size = len(tiles_data)
+        output_file_paths = []
+
+        for item_index, item in enumerate(self.__items):
+            item_size, item_output_file_paths = item.write_tiles_group_member_header(items_map_data[item_index],
+                                                                                     tiles_group_arrays)
+            output_file_paths += item_output_file_paths
+            total_size += item_size
+            tiles_group_arrays = []
+
+        header_file_path = self.__build_folder_path + '/bn_regular_bg_tiles_items_' + name + '.h'
+        output_file_paths.append(header_file_path)
+
+        with open(header_file_path, 'w') as header_file:
+            include_guard = 'BN_REGULAR_BG_TILES_ITEMS_' + name.upper() + '_H'
+            header_file.write('#ifndef ' + include_guard + '\n')
+            header_file.write('#define ' + include_guard + '\n')
+            header_file.write('\n')
+            header_file.write('#include "bn_regular_bg_tiles_item.h"' + '\n')
+            header_file.write('\n')
+            header_file.write('extern const bn::tile ' + name + '_bn_gfxTiles[' + str(tiles_count) + '];' + '\n')
+            header_file.write('\n')
+            header_file.write('namespace bn::regular_bg_tiles_items' + '\n')
+            header_file.write('{' + '\n')
+            header_file.write('    constexpr inline regular_bg_tiles_item ' + name + '(' + '\n            ' +
+                              'span<const tile>(' + name + '_bn_gfxTiles, ' +
+                              str(tiles_count) + '), ' + bpp_mode_label + ', ' + compression_label('none') +
+                              ');' + '\n')
+            header_file.write('}' + '\n')
+            header_file.write('\n')
+            header_file.write('#endif' + '\n')
+            header_file.write('\n')
+
+        return total_size, header_file_path, output_file_paths
+
+
 class AffineBgItem:
 
     def __init__(self, file_path, file_name_no_ext, build_folder_path, info):
@@ -1190,73 +1398,13 @@ class AffineBgItem:
                 self.__map_compression = 'none'
 
     def process(self, grit):
-        tiles_compression = self.__tiles_compression
-        palette_compression = self.__palette_compression
-        map_compression = self.__map_compression
-
-        if tiles_compression.startswith('auto'):
-            test_huffman = tiles_compression == 'auto'
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'none', None)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'run_length',
-                                                                         file_size)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'lz77', file_size)
-
-            if test_huffman:
-                tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'huffman',
-                                                                             file_size)
-
-        if palette_compression.startswith('auto'):
-            test_huffman = palette_compression == 'auto'
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'none', None)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'run_length',
-                                                                             file_size)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'lz77',
-                                                                             file_size)
+        tiles_compression, palette_compression, map_compression = process_compressions(
+            [self.__tiles_compression, self.__palette_compression, self.__map_compression], ['Tiles', 'Pal', 'Map'],
+            self.__build_folder_path, self.__file_name_no_ext,
+            lambda *compressions: self.__execute_command(grit, *compressions))
+        return self.__write_header(tiles_compression, palette_compression, map_compression)
 
-            if test_huffman:
-                palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'huffman',
-                                                                                 file_size)
-
-        if map_compression.startswith('auto'):
-            test_huffman = map_compression == 'auto'
-            map_compression, file_size = self.__test_map_compression(grit, map_compression, 'none', None)
-            map_compression, file_size = self.__test_map_compression(grit, map_compression, 'run_length', file_size)
-            map_compression, file_size = self.__test_map_compression(grit, map_compression, 'lz77', file_size)
-
-            if test_huffman:
-                map_compression, file_size = self.__test_map_compression(grit, map_compression, 'huffman', file_size)
-
-        self.__execute_command(grit, tiles_compression, palette_compression, map_compression)
-        return self.__write_header(tiles_compression, palette_compression, map_compression, False)
-
-    def __test_tiles_compression(self, grit, best_tiles_compression, new_tiles_compression, best_file_size):
-        self.__execute_command(grit, new_tiles_compression, 'none', 'none')
-        new_file_size = self.__write_header(new_tiles_compression, 'none', 'none', True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_tiles_compression, new_file_size
-
-        return best_tiles_compression, best_file_size
-
-    def __test_palette_compression(self, grit, best_palette_compression, new_palette_compression, best_file_size):
-        self.__execute_command(grit, 'none', new_palette_compression, 'none')
-        new_file_size = self.__write_header('none', new_palette_compression, 'none', True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_palette_compression, new_file_size
-
-        return best_palette_compression, best_file_size
-
-    def __test_map_compression(self, grit, best_map_compression, new_map_compression, best_file_size):
-        self.__execute_command(grit, 'none', 'none', new_map_compression)
-        new_file_size = self.__write_header('none', 'none', new_map_compression, True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_map_compression, new_file_size
-
-        return best_map_compression, best_file_size
-
-    def __write_header(self, tiles_compression, palette_compression, map_compression, skip_write):
+    def __write_header(self, tiles_compression, palette_compression, map_compression):
         name = self.__file_name_no_ext
         grit_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.h'
         header_file_path = self.__build_folder_path + '/bn_affine_bg_items_' + name + '.h'
@@ -1283,11 +1431,7 @@ class AffineBgItem:
 
                 if 'Total size:' in grit_line:
                     total_size = int(grit_line.split()[-1])
-
-                    if skip_write:
-                        return total_size
-                    else:
-                        break
+                    break
 
         remove_file(grit_file_path)
 
@@ -1390,54 +1534,12 @@ class AffineBgTilesItem:
             self.__palette_compression = 'none'
 
     def process(self, grit):
-        tiles_compression = self.__tiles_compression
-        palette_compression = self.__palette_compression
-
-        if tiles_compression.startswith('auto'):
-            test_huffman = tiles_compression == 'auto'
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'none', None)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'run_length',
-                                                                         file_size)
-            tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'lz77', file_size)
-
-            if test_huffman:
-                tiles_compression, file_size = self.__test_tiles_compression(grit, tiles_compression, 'huffman',
-                                                                             file_size)
-
-        if palette_compression.startswith('auto'):
-            test_huffman = palette_compression == 'auto'
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'none', None)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'run_length',
-                                                                             file_size)
-            palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'lz77',
-                                                                             file_size)
+        tiles_compression, palette_compression = process_compressions(
+            [self.__tiles_compression, self.__palette_compression], ['Tiles', 'Pal'], self.__build_folder_path,
+            self.__file_name_no_ext, lambda *compressions: self.__execute_command(grit, *compressions))
+        return self.__write_header(tiles_compression, palette_compression)
 
-            if test_huffman:
-                palette_compression, file_size = self.__test_palette_compression(grit, palette_compression, 'huffman',
-                                                                                 file_size)
-
-        self.__execute_command(grit, tiles_compression, palette_compression)
-        return self.__write_header(tiles_compression, palette_compression, False)
-
-    def __test_tiles_compression(self, grit, best_compression, new_compression, best_file_size):
-        self.__execute_command(grit, new_compression, 'none')
-        new_file_size = self.__write_header(new_compression, 'none', True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_compression, new_file_size
-
-        return best_compression, best_file_size
-
-    def __test_palette_compression(self, grit, best_compression, new_compression, best_file_size):
-        self.__execute_command(grit, 'none', new_compression)
-        new_file_size = self.__write_header('none', new_compression, True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_compression, new_file_size
-
-        return best_compression, best_file_size
-
-    def __write_header(self, tiles_compression, palette_compression, skip_write):
+    def __write_header(self, tiles_compression, palette_compression):
         name = self.__file_name_no_ext
         grit_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.h'
         header_file_path = self.__build_folder_path + '/bn_affine_bg_tiles_items_' + name + '.h'
@@ -1464,11 +1566,7 @@ class AffineBgTilesItem:
 
                 if 'Total size:' in grit_line:
                     total_size = int(grit_line.split()[-1])
-
-                    if skip_write:
-                        return total_size
-                    else:
-                        break
+                    break
 
         remove_file(grit_file_path)
 
@@ -1547,30 +1645,12 @@ class BgPaletteItem:
             self.__compression = 'none'
 
     def process(self, grit):
-        compression = self.__compression
+        compression, = process_compressions(
+            [self.__compression], ['Pal'], self.__build_folder_path, self.__file_name_no_ext,
+            lambda *compressions: self.__execute_command(grit, *compressions))
+        return self.__write_header(compression)
 
-        if compression.startswith('auto'):
-            test_huffman = compression == 'auto'
-            compression, file_size = self.__test_compression(grit, compression, 'none', None)
-            compression, file_size = self.__test_compression(grit, compression, 'run_length', file_size)
-            compression, file_size = self.__test_compression(grit, compression, 'lz77', file_size)
-
-            if test_huffman:
-                compression, file_size = self.__test_compression(grit, compression, 'huffman', file_size)
-
-        self.__execute_command(grit, compression)
-        return self.__write_header(compression, False)
-
-    def __test_compression(self, grit, best_compression, new_compression, best_file_size):
-        self.__execute_command(grit, new_compression)
-        new_file_size = self.__write_header(new_compression, True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_compression, new_file_size
-
-        return best_compression, best_file_size
-
-    def __write_header(self, compression, skip_write):
+    def __write_header(self, compression):
         name = self.__file_name_no_ext
         grit_file_path = self.__build_folder_path + '/' + name + '_bn_gfx.h'
         header_file_path = self.__build_folder_path + '/bn_bg_palette_items_' + name + '.h'
@@ -1582,11 +1662,7 @@ class BgPaletteItem:
             for grit_line in grit_data.splitlines():
                 if 'Total size:' in grit_line:
                     total_size = int(grit_line.split()[-1])
-
-                    if skip_write:
-                        return total_size
-                    else:
-                        break
+                    break
 
         remove_file(grit_file_path)
 
@@ -1610,7 +1686,10 @@ class BgPaletteItem:
             header_file.write('    constexpr inline bg_palette_item ' + name + '(' +
                               'span<const color>(' + name + '_bn_gfxPal, ' +
                               str(self.__colors_count) + '), ' + '\n            ' +
-                              bpp_mode_label + ', ' + compression_label(compression) + ');' + '\n')
+                              bpp_mode_label + ', ' + compression_label(compression) +
+                              colors_hash_argument(self.__build_folder_path, name, self.__colors_count, self.__bpp_8,
+                                                   compression) +
+                              ');' + '\n')
             header_file.write('}' + '\n')
             header_file.write('\n')
             header_file.write('#endif' + '\n')
@@ -1630,25 +1709,45 @@ class BgPaletteItem:
             raise ValueError(grit + ' call failed (return code ' + str(e.returncode) + '): ' + str(e.output))
 
 
+def load_graphics_json(json_file_path):
+    try:
+        with open(json_file_path) as json_file:
+            return json.load(json_file)
+    except Exception as exception:
+        raise ValueError(json_file_path + ' graphics json file parse failed: ' + str(exception))
+
+
+def graphics_json_tiles_group(json_file_path):
+    # Invalid json files are reported when they are processed:
+    try:
+        info = load_graphics_json(json_file_path)
+
+        if info['type'] == 'regular_bg' and 'tiles_group' in info:
+            return str(info['tiles_group'])
+    except Exception:
+        pass
+
+    return None
+
+
 class GraphicsFileInfo:
 
-    def __init__(self, json_file_path, file_path, file_name, file_name_no_ext, file_info_path):
+    def __init__(self, json_file_path, file_path, file_name, file_name_no_ext, file_info_path, inputs_hash):
         self.__json_file_path = json_file_path
         self.__file_path = file_path
         self.__file_name = file_name
         self.__file_name_no_ext = file_name_no_ext
         self.__file_info_path = file_info_path
+        self.__inputs_hash = inputs_hash
 
     def print_file_name(self):
         print(self.__file_name)
 
-    def process(self, grit, build_folder_path):
+    def process(self, grit, build_cache):
+        build_folder_path = build_cache.build_folder_path
+
         try:
-            try:
-                with open(self.__json_file_path) as json_file:
-                    info = json.load(json_file)
-            except Exception as exception:
-                raise ValueError(self.__json_file_path + ' graphics json file parse failed: ' + str(exception))
+            info = load_graphics_json(self.__json_file_path)
 
             try:
                 graphics_type = str(info['type'])
@@ -1676,26 +1775,58 @@ class GraphicsFileInfo:
                                  '" found in graphics json file: ' + self.__json_file_path)
 
             total_size, header_file_path = item.process(grit)
-
-            with open(self.__file_info_path, 'w') as file_info:
-                file_info.write('')
+            output_file_paths = [build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx.s', header_file_path]
+            build_cache.store(self.__file_info_path, self.__inputs_hash, output_file_paths, total_size)
 
             return [self.__file_name, header_file_path, total_size]
         except Exception as exc:
             return [self.__file_name, exc]
 
 
+class RegularBgTilesGroupFileInfo:
+
+    def __init__(self, name, graphics_file_infos, file_info_path, inputs_hash):
+        self.__name = name
+        self.__graphics_file_infos = graphics_file_infos
+        self.__file_info_path = file_info_path
+        self.__inputs_hash = inputs_hash
+
+    def print_file_name(self):
+        for json_file_path, file_path, file_name, file_name_no_ext in self.__graphics_file_infos:
+            print(file_name)
+
+    def process(self, grit, build_cache):
+        build_folder_path = build_cache.build_folder_path
+        tag = self.__name + ' tiles group'
+
+        try:
+            items = []
+
+            for json_file_path, file_path, file_name, file_name_no_ext in self.__graphics_file_infos:
+                info = load_graphics_json(json_file_path)
+                items.append(RegularBgItem(file_path, file_name_no_ext, build_folder_path, info))
+
+            tiles_group = RegularBgTilesGroup(self.__name, items, build_folder_path)
+            total_size, header_file_path, output_file_paths = tiles_group.process(grit)
+            build_cache.store(self.__file_info_path, self.__inputs_hash, output_file_paths, total_size)
+
+            return [tag, header_file_path, total_size]
+        except Exception as exc:
+            return [tag, exc]
+
+
 class GraphicsFileInfoProcessor:
 
-    def __init__(self, grit, build_folder_path):
+    def __init__(self, grit, build_cache):
         self.__grit = grit
-        self.__build_folder_path = build_folder_path
+        self.__build_cache = build_cache
 
     def __call__(self, graphics_file_info):
-        return graphics_file_info.process(self.__grit, self.__build_folder_path)
+        return graphics_file_info.process(self.__grit, self.__build_cache)
 
 
-def list_graphics_file_infos(graphics_paths, build_folder_path):
+def list_graphics_file_infos(graphics_paths, build_cache):
+    build_folder_path = build_cache.build_folder_path
     graphics_file_paths = []
 
     for graphics_path in graphics_paths.split(' '):
@@ -1711,6 +1842,8 @@ def list_graphics_file_infos(graphics_paths, build_folder_path):
             graphics_file_paths.append(graphics_path)
 
     graphics_file_infos = []
+    tiles_groups = {}
+    outdated_tiles_groups = set()
     file_names_set = set()
 
     for graphics_file_path in graphics_file_paths:
@@ -1734,29 +1867,57 @@ def list_graphics_file_infos(graphics_paths, build_folder_path):
                     raise ValueError('Graphics json file not found: ' + json_file_path)
 
                 file_info_path = build_folder_path + '/_bn_' + graphics_file_name_no_ext + '_graphics_file_info.txt'
+                tiles_group = graphics_json_tiles_group(json_file_path)
 
-                if not os.path.exists(file_info_path):
-                    build = True
-                else:
-                    file_info_mtime = os.path.getmtime(file_info_path)
-                    graphics_file_mtime = os.path.getmtime(graphics_file_path)
+                if tiles_group is not None:
+                    tiles_groups.setdefault(tiles_group, []).append(
+                        (json_file_path, graphics_file_path, graphics_file_name, graphics_file_name_no_ext))
 
-                    if file_info_mtime < graphics_file_mtime:
-                        build = True
-                    else:
-                        json_file_mtime = os.path.getmtime(json_file_path)
-                        build = file_info_mtime < json_file_mtime
+                    # Outputs of tiles group items are overwritten by the group, so they can't be reused alone.
+                    # If they have been processed alone, the group outputs must be generated again:
+                    if os.path.isfile(file_info_path):
+                        outdated_tiles_groups.add(tiles_group)
+                        remove_file(file_info_path)
 
-                if build:
+                    continue
+
+                inputs_hash = build_cache.inputs_hash([graphics_file_path, json_file_path])
+
+                if build_cache.lookup(file_info_path, inputs_hash) is None:
                     graphics_file_infos.append(GraphicsFileInfo(
                         json_file_path, graphics_file_path, graphics_file_name, graphics_file_name_no_ext,
-                        file_info_path))
+                        file_info_path, inputs_hash))
+
+    for tiles_group, tiles_group_file_infos in sorted(tiles_groups.items()):
+        if tiles_group in file_names_set:
+            raise ValueError('There\'s a tiles group with the same name as a graphics file: ' + tiles_group)
+
+        tiles_group_file_infos.sort(key=lambda tiles_group_file_info: tiles_group_file_info[3])
+        file_info_path = build_folder_path + '/_bn_' + tiles_group + '_tiles_group_file_info.txt'
+        tiles_group_file_paths = []
+
+        for json_file_path, graphics_file_path, graphics_file_name, graphics_file_name_no_ext in tiles_group_file_infos:
+            tiles_group_file_paths.append(graphics_file_path)
+            tiles_group_file_paths.append(json_file_path)
+
+        inputs_hash = build_cache.inputs_hash(tiles_group_file_paths, [tiles_group])
+
+        if tiles_group in outdated_tiles_groups or build_cache.lookup(file_info_path, inputs_hash) is None:
+            graphics_file_infos.append(RegularBgTilesGroupFileInfo(
+                tiles_group, tiles_group_file_infos, file_info_path, inputs_hash))
 
     return graphics_file_infos
 
 
-def process_graphics(grit, graphics_paths, build_folder_path):
-    graphics_file_infos = list_graphics_file_infos(graphics_paths, build_folder_path)
+def process_graphics(grit, graphics_paths, build_folder_path, cache_folder_path=None):
+    tools_folder_path = os.path.dirname(os.path.abspath(__file__))
+    tool_file_paths = [os.path.join(tools_folder_path, 'butano_graphics_tool.py'),
+                       os.path.join(tools_folder_path, 'bmp.py'),
+                       os.path.join(tools_folder_path, 'gba_compression.py'),
+                       os.path.join(tools_folder_path, 'build_cache.py'),
+                       os.path.join(tools_folder_path, 'file_info.py')]
+    build_cache = BuildCache(build_folder_path, cache_folder_path, tool_file_paths, [grit])
+    graphics_file_infos = list_graphics_file_infos(graphics_paths, build_cache)
 
     if len(graphics_file_infos) > 0:
         for graphics_file_info in graphics_file_infos:
@@ -1765,7 +1926,7 @@ def process_graphics(grit, graphics_paths, build_folder_path):
         sys.stdout.flush()
 
         pool = Pool()
-        process_results = pool.map(GraphicsFileInfoProcessor(grit, build_folder_path), graphics_file_infos)
+        process_results = pool.map(GraphicsFileInfoProcessor(grit, build_cache), graphics_file_infos)
         pool.close()
 
         total_size = 0
@@ -1789,3 +1950,5 @@ def process_graphics(grit, graphics_paths, build_folder_path):
             exit(-1)
 
         print('    ' + 'Processed graphics size: ' + str(total_size) + ' bytes')
+
+    build_cache.print_hit_rate('Graphics')
@@ -0,0 +1,396 @@
+"""
+Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+zlib License, see LICENSE file.
+"""
+
+import argparse
+import bisect
+import json
+import re
+import subprocess
+import sys
+import traceback
+
+
+ROM_START = 0x08000000
+ROM_END = 0x0E000000
+EWRAM_START = 0x02000000
+EWRAM_END = 0x03000000
+IWRAM_START = 0x03000000
+IWRAM_END = 0x04000000
+
+# Profiler ids logged by the engine (see bn_core.cpp) and the functions that they measure.
+# The vblank callback is provided by the user, so its ticks can't be assigned to any engine function:
+ENGINE_PROFILER_IDS = {
+    'eng_update': 'bn::core::(anonymous namespace)::update_impl',
+    'eng_commit': 'bn::core::(anonymous namespace)::update_impl',
+    'eng_cameras_update': 'bn::cameras_manager::update',
+    'eng_spr_anims_update': 'bn::sprite_animations_manager::update',
+    'eng_sprites_update': 'bn::sprites_manager::update',
+    'eng_spr_tiles_update': 'bn::sprite_tiles_manager::update',
+    'eng_bgs_update': 'bn::bgs_manager::update',
+    'eng_bg_blocks_update': 'bn::bg_blocks_manager::update',
+    'eng_palettes_update': 'bn::palettes_manager::update',
+    'eng_display_update': 'bn::display_manager::update',
+    'eng_hblank_fx_update': 'bn::hblank_effects_manager::update',
+    'eng_audio_commands': 'bn::audio_manager::execute_commands',
+    'eng_display_commit': 'bn::display_manager::commit',
+    'eng_sprites_commit': 'bn::sprites_manager::commit',
+    'eng_bgs_commit': 'bn::bgs_manager::commit',
+    'eng_palettes_commit': 'bn::palettes_manager::commit',
+    'eng_spr_tiles_unc_commit': 'bn::sprite_tiles_manager::commit_uncompressed',
+    'eng_bg_blocks_unc_commit': 'bn::bg_blocks_manager::commit_uncompressed',
+    'eng_spr_tiles_cmp_commit': 'bn::sprite_tiles_manager::commit_compressed',
+    'eng_bg_blocks_cmp_commit': 'bn::bg_blocks_manager::commit_compressed',
+    'eng_vblank_callback': None,
+    'eng_hdma_update': 'bn::hdma_manager::update',
+    'eng_hblank_fx_commit': 'bn::hblank_effects_manager::commit',
+    'eng_big_maps_commit': 'bn::bgs_manager::commit_big_maps',
+    'eng_keypad': 'bn::keypad_manager::update',
+    'eng_audio_update': 'bn::audio_manager::update',
+    'eng_audio_commit': 'bn::audio_manager::commit',
+}
+
+
+class Function:
+
+    def __init__(self, name, address, size, object_name):
+        self.name = name
+        self.address = address
+        self.size = size
+        self.object_name = object_name
+        self.weight = 0
+
+    def region(self):
+        if ROM_START <= self.address < ROM_END:
+            return 'rom'
+
+        if IWRAM_START <= self.address < IWRAM_END:
+            return 'iwram'
+
+        if EWRAM_START <= self.address < EWRAM_END:
+            return 'ewram'
+
+        return 'unknown'
+
+
+def _demangle(names):
+    try:
+        result = subprocess.run(['c++filt'], input='\n'.join(names), capture_output=True, text=True, check=True)
+        demangled_names = result.stdout.splitlines()
+
+        if len(demangled_names) == len(names):
+            return demangled_names
+    except (OSError, subprocess.CalledProcessError):
+        pass
+
+    return names
+
+
+def read_map_file(map_file_path):
+    section_regex = re.compile(r'^ (\.(?:text|iwram|ewram)\S*)\s*(?:(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)\s+(.+))?$')
+    address_regex = re.compile(r'^\s+(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)\s+(.+)$')
+    symbol_regex = re.compile(r'^\s+(0x[0-9a-fA-F]+)\s{2,}(\S.*)$')
+    functions = []
+    pending_section = None
+    current_function = None
+    memory_map_found = False
+
+    with open(map_file_path, 'r') as map_file:
+        for line in map_file:
+            line = line.rstrip('\n')
+
+            if not memory_map_found:
+                memory_map_found = line.startswith('Linker script and memory map')
+                continue
+
+            section_match = section_regex.match(line)
+
+            if section_match:
+                pending_section = None
+                current_function = None
+                section_name = section_match.group(1)
+
+                if section_match.group(2) is None:
+                    pending_section = section_name
+                else:
+                    current_function = _add_function(functions, section_name, section_match.group(2),
+                                                     section_match.group(3), section_match.group(4))
+                continue
+
+            if pending_section is not None:
+                address_match = address_regex.match(line)
+                pending_section_name = pending_section
+                pending_section = None
+
+                if address_match:
+                    current_function = _add_function(functions, pending_section_name, address_match.group(1),
+                                                     address_match.group(2), address_match.group(3))
+                continue
+
+            if current_function is not None:
+                symbol_match = symbol_regex.match(line)
+
+                if symbol_match and int(symbol_match.group(1), 16) == current_function.address:
+                    symbol_name = symbol_match.group(2).strip()
+
+                    if not symbol_name.startswith('.') and '=' not in symbol_name:
+                        current_function.name = symbol_name
+                        current_function = None
+                else:
+                    current_function = None
+
+    demangled_names = _demangle([function.name for function in functions])
+
+    for function, demangled_name in zip(functions, demangled_names):
+        function.name = demangled_name
+
+    functions.sort(key=lambda function: function.address)
+    return functions
+
+
+def _add_function(functions, section_name, address, size, object_name):
+    address = int(address, 16)
+    size = int(size, 16)
+
+    if address == 0 or size == 0:
+        return None
+
+    name = section_name
+
+    for prefix in ('.text.', '.iwram.', '.ewram.'):
+        if name.startswith(prefix):
+            name = name[len(prefix):]
+            break
+
+    function = Function(name, address, size, object_name.strip())
+    functions.append(function)
+    return function
+
+
+def add_samples(functions, samples_file_path):
+    starts = [function.address for function in functions]
+    sample_regex = re.compile(r'(0x[0-9a-fA-F]+|[0-9a-fA-F]{8})\s+(\d+)\s*$')
+    total_samples = 0
+    missed_samples = 0
+
+    with open(samples_file_path, 'r') as samples_file:
+        for line in samples_file:
+            sample_match = sample_regex.search(line)
+
+            if sample_match:
+                address = int(sample_match.group(1), 16) & ~1
+                count = int(sample_match.group(2))
+                index = bisect.bisect_right(starts, address) - 1
+                total_samples += count
+
+                if index >= 0 and address < functions[index].address + functions[index].size:
+                    functions[index].weight += count
+                else:
+                    missed_samples += count
+
+    return total_samples, missed_samples
+
+
+def _function_path(function_name):
+    # Removes the parameters list (and qualifiers like const) from a demangled function name,
+    # keeping parentheses of the function path like the ones of '(anonymous namespace)':
+    parameters_end = function_name.rfind(')')
+
+    if parameters_end < 0:
+        return function_name
+
+    depth = 0
+
+    for index in range(parameters_end, -1, -1):
+        character = function_name[index]
+
+        if character == ')':
+            depth += 1
+        elif character == '(':
+            depth -= 1
+
+            if depth == 0:
+                return function_name[:index]
+
+    return function_name
+
+
+def add_profiler_entries(functions, profiler_file_path):
+    profiler_regex = re.compile(r'profiler: (.+?) (\d+) (\d+)\s*$')
+    total_ticks = 0
+    missed_ticks = 0
+
+    with open(profiler_file_path, 'r') as profiler_file:
+        for line in profiler_file:
+            profiler_match = profiler_regex.search(line)
+
+            if profiler_match:
+                entry_id = profiler_match.group(1)
+                ticks = int(profiler_match.group(2))
+                function_name = ENGINE_PROFILER_IDS.get(entry_id, entry_id)
+                matched_functions = [function for function in functions
+                                     if function_name and _function_path(function.name).endswith(function_name)]
+                total_ticks += ticks
+
+                if matched_functions:
+                    for matched_function in matched_functions:
+                        matched_function.weight += ticks / len(matched_functions)
+                else:
+                    missed_ticks += ticks
+
+    return total_ticks, missed_ticks
+
+
+def select_functions(functions, total_weight, args):
+    fetch_cycles = {'rom': args.rom_fetch_cycles, 'ewram': args.ewram_fetch_cycles}
+    candidates = []
+
+    for function in functions:
+        region = function.region()
+
+        if function.weight > 0 and region in fetch_cycles:
+            cycles = fetch_cycles[region]
+            gain = (function.weight / total_weight) * args.fetch_weight * (1 - (1 / cycles))
+            iwram_bytes = int(function.size * args.arm_size_factor + 3) & ~3
+            candidates.append([function, gain, iwram_bytes, False])
+
+    candidates.sort(key=lambda candidate: candidate[1] / candidate[2], reverse=True)
+    used_bytes = 0
+
+    for candidate in candidates:
+        if used_bytes + candidate[2] <= args.budget:
+            candidate[3] = True
+            used_bytes += candidate[2]
+
+    candidates.sort(key=lambda candidate: candidate[1], reverse=True)
+    return candidates, used_bytes
+
+
+def object_suggestions(functions, candidates):
+    object_bytes = {}
+    selected_object_bytes = {}
+
+    for function in functions:
+        object_bytes[function.object_name] = object_bytes.get(function.object_name, 0) + function.size
+
+    for candidate in candidates:
+        if candidate[3]:
+            object_name = candidate[0].object_name
+            selected_object_bytes[object_name] = selected_object_bytes.get(object_name, 0) + candidate[0].size
+
+    result = []
+
+    for object_name, selected_bytes in selected_object_bytes.items():
+        ratio = selected_bytes / object_bytes[object_name]
+
+        if ratio >= 0.75 and 'ltrans' not in object_name:
+            result.append([object_name, ratio, 'rename to .bn_iwram.cpp'])
+        else:
+            result.append([object_name, ratio, 'use BN_CODE_IWRAM'])
+
+    result.sort(key=lambda suggestion: suggestion[1], reverse=True)
+    return result
+
+
+def write_report(candidates, used_bytes, suggestions, total_weight, missed_weight, args):
+    selected_gain = sum(candidate[1] for candidate in candidates if candidate[3])
+
+    print('IWRAM placement report')
+    print('')
+    print('Profiled weight: ' + str(round(total_weight)) + ' (' + str(round(missed_weight)) + ' not symbolized)')
+    print('Budget: ' + str(args.budget) + ' bytes (' + str(used_bytes) + ' used)')
+    print('Estimated CPU time reduction: ' + str(round(selected_gain * 100, 2)) + '%')
+    print('')
+    print('{:>5} {:>8} {:>8} {:>6} {:>8}  {}'.format('rank', 'time%', 'gain%', 'region', 'bytes', 'function'))
+
+    for index, candidate in enumerate(candidates[:args.max_rows]):
+        function = candidate[0]
+        print('{:>5} {:>8.2f} {:>8.2f} {:>6} {:>8}  {}{}'.format(
+            index + 1, function.weight * 100 / total_weight, candidate[1] * 100, function.region(), candidate[2],
+            function.name, ' [selected]' if candidate[3] else ''))
+
+    if suggestions:
+        print('')
+        print('Suggested changes:')
+
+        for suggestion in suggestions:
+            print('    ' + suggestion[0] + ': ' + suggestion[2] + ' (' + str(round(suggestion[1] * 100)) +
+                  '% of its code selected)')
+
+    if args.json is not None:
+        report = {
+            'total_weight': total_weight,
+            'missed_weight': missed_weight,
+            'budget': args.budget,
+            'used_bytes': used_bytes,
+            'estimated_gain': selected_gain,
+            'functions': [{
+                'name': candidate[0].name,
+                'object': candidate[0].object_name,
+                'region': candidate[0].region(),
+                'size': candidate[0].size,
+                'iwram_bytes': candidate[2],
+                'weight': candidate[0].weight,
+                'gain': candidate[1],
+                'selected': candidate[3],
+            } for candidate in candidates],
+            'suggestions': [{
+                'object': suggestion[0],
+                'selected_ratio': suggestion[1],
+                'action': suggestion[2],
+            } for suggestion in suggestions],
+        }
+
+        with open(args.json, 'w') as json_file:
+            json.dump(report, json_file, indent=4)
+
+
+def process_iwram_placement(args):
+    if args.samples is None and args.profiler is None:
+        raise ValueError('Samples or profiler file path required')
+
+    functions = read_map_file(args.map)
+
+    if not functions:
+        raise ValueError('No functions found in map file: ' + args.map)
+
+    total_weight = 0
+    missed_weight = 0
+
+    if args.samples is not None:
+        total_weight, missed_weight = add_samples(functions, args.samples)
+    else:
+        total_weight, missed_weight = add_profiler_entries(functions, args.profiler)
+
+    if total_weight <= 0:
+        raise ValueError('No profiling data found')
+
+    candidates, used_bytes = select_functions(functions, total_weight, args)
+    suggestions = object_suggestions(functions, candidates)
+    write_report(candidates, used_bytes, suggestions, total_weight, missed_weight, args)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description='Butano profile-guided IWRAM placement tool.')
+    parser.add_argument('--map', required=True, help='linker map file path')
+    parser.add_argument('--samples', help='bn::sampling_profiler::log output file path (address and hits count per line)')
+    parser.add_argument('--profiler', help='bn::profiler::log output file path')
+    parser.add_argument('--budget', type=int, default=4096, help='IWRAM budget in bytes')
+    parser.add_argument('--rom-fetch-cycles', type=float, default=2,
+                        help='average cycles per ROM code fetch (IWRAM fetch takes one cycle)')
+    parser.add_argument('--ewram-fetch-cycles', type=float, default=3,
+                        help='average cycles per EWRAM code fetch (IWRAM fetch takes one cycle)')
+    parser.add_argument('--fetch-weight', type=float, default=0.6,
+                        help='estimated fraction of CPU time spent fetching code')
+    parser.add_argument('--arm-size-factor', type=float, default=1.5,
+                        help='estimated size increase when building Thumb code in ARM mode')
+    parser.add_argument('--max-rows', type=int, default=40, help='maximum number of functions to print')
+    parser.add_argument('--json', help='JSON report output file path')
+
+    try:
+        process_iwram_placement(parser.parse_args())
+    except Exception as ex:
+        sys.stderr.write('Error: ' + str(ex) + '\n')
+        traceback.print_exc()
+        exit(-1)
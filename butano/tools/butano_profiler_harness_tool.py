@@ -0,0 +1,320 @@
+"""
+Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+zlib License, see LICENSE file.
+"""
+
+import argparse
+import json
+import os
+import queue
+import re
+import shlex
+import subprocess
+import sys
+import threading
+import time
+import traceback
+
+
+_build_folder_name = 'build_profiler_harness'
+
+_config_header_name = 'bn_profiler_harness_config.h'
+
+_keys = {
+    'A': 0x0001,
+    'B': 0x0002,
+    'SELECT': 0x0004,
+    'START': 0x0008,
+    'RIGHT': 0x0010,
+    'LEFT': 0x0020,
+    'UP': 0x0040,
+    'DOWN': 0x0080,
+    'R': 0x0100,
+    'L': 0x0200,
+}
+
+
+def keypad_commands_from_script(script):
+    commands = []
+
+    for step in script:
+        frames = int(step['frames'])
+        keys = 0
+
+        if frames <= 0:
+            raise ValueError('Invalid keypad script frames: ' + str(frames))
+
+        for key in step.get('keys', []):
+            key_value = _keys.get(key.upper())
+
+            if key_value is None:
+                raise ValueError('Invalid keypad script key: ' + key)
+
+            keys |= key_value
+
+        command = chr((keys & 0b11111) + ord('0')) + chr(((keys >> 5) & 0b11111) + ord('0'))
+        commands.append(command * frames)
+
+    return ''.join(commands)
+
+
+def keypad_commands_from_file(commands_file_path):
+    with open(commands_file_path, 'r') as commands_file:
+        result = ''.join(commands_file.read().split())
+
+    if len(result) % 2 or re.search(r'[^0-O]', result):
+        raise ValueError('Invalid keypad commands file: ' + commands_file_path)
+
+    return result
+
+
+class Target:
+
+    def __init__(self, config_folder_path, info):
+        self.name = info['name']
+        self.path = os.path.normpath(os.path.join(config_folder_path, info['path']))
+        self.frames = int(info.get('frames', 0))
+        self.timeout = float(info.get('timeout', 60))
+        self.profile_engine = bool(info.get('profile_engine', False))
+        self.profile_engine_detailed = bool(info.get('profile_engine_detailed', False))
+        self.defines = info.get('defines', {})
+
+        if 'keypad' in info:
+            self.keypad_commands = keypad_commands_from_script(info['keypad'])
+        elif 'keypad_commands_file' in info:
+            commands_file_path = os.path.join(config_folder_path, info['keypad_commands_file'])
+            self.keypad_commands = keypad_commands_from_file(commands_file_path)
+        else:
+            self.keypad_commands = ''
+
+        if self.frames < 0:
+            raise ValueError('Invalid frames: ' + str(self.frames) + ' (target: ' + self.name + ')')
+
+        if not os.path.isdir(self.path):
+            raise ValueError('Target folder not found: ' + self.path + ' (target: ' + self.name + ')')
+
+    def rom_file_path(self):
+        return os.path.join(self.path, self.name + '_profiler_harness.gba')
+
+    def write_config_header(self):
+        defines = {
+            'BN_CFG_LOG_ENABLED': 'true',
+            'BN_CFG_LOG_BACKEND': 'BN_LOG_BACKEND_MGBA',
+            'BN_CFG_PROFILER_ENABLED': 'true',
+            'BN_CFG_PROFILER_LOG_ENGINE': 'true' if self.profile_engine else 'false',
+            'BN_CFG_PROFILER_LOG_ENGINE_DETAILED': 'true' if self.profile_engine_detailed else 'false',
+            'BN_CFG_PROFILER_LOG_FRAMES': str(self.frames),
+            'BN_CFG_KEYPAD_COMMANDS': '"' + self.keypad_commands + '"',
+        }
+
+        for define_name, define_value in self.defines.items():
+            defines[define_name] = str(define_value)
+
+        build_folder_path = os.path.join(self.path, _build_folder_name)
+        os.makedirs(build_folder_path, exist_ok=True)
+        header_file_path = os.path.join(build_folder_path, _config_header_name)
+        lines = ['// Generated by butano_profiler_harness_tool.py, do not edit.', '']
+
+        for define_name, define_value in defines.items():
+            lines.append('#undef ' + define_name)
+            lines.append('#define ' + define_name + ' ' + define_value)
+            lines.append('')
+
+        header = '\n'.join(lines)
+
+        # Don't touch the header if it has not changed to avoid rebuilding the whole project:
+        if os.path.isfile(header_file_path):
+            with open(header_file_path, 'r') as header_file:
+                if header_file.read() == header:
+                    return header_file_path
+
+        with open(header_file_path, 'w') as header_file:
+            header_file.write(header)
+
+        return header_file_path
+
+    def build(self, make, jobs):
+        header_file_path = self.write_config_header()
+        command = [make, '-C', self.path, '-j' + str(jobs), 'BUILD=' + _build_folder_name,
+                   'TARGET=' + self.name + '_profiler_harness', 'EXTRAFLAGS=-include ' + header_file_path]
+        process = subprocess.run(command, capture_output=True, text=True)
+
+        if process.returncode != 0:
+            raise ValueError('Target build failed (target: ' + self.name + '):\n' + process.stdout + process.stderr)
+
+
+def _read_lines(stream, lines_queue):
+    for line in stream:
+        lines_queue.put(line)
+
+    lines_queue.put(None)
+
+
+def run_target(target, mgba, mgba_args):
+    command = [mgba] + mgba_args + [target.rom_file_path()]
+    process = subprocess.Popen(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True, errors='replace')
+    lines_queue = queue.Queue()
+    reader = threading.Thread(target=_read_lines, args=(process.stdout, lines_queue), daemon=True)
+    reader.start()
+    deadline = time.monotonic() + target.timeout
+    profiler_regex = re.compile(r'(?<!sampling_)(profiler: .*)$')
+    profiler_lines = []
+
+    try:
+        while True:
+            remaining_time = deadline - time.monotonic()
+
+            if remaining_time <= 0:
+                raise ValueError('Profiler results not found before timeout (target: ' + target.name + ')')
+
+            try:
+                line = lines_queue.get(timeout=remaining_time)
+            except queue.Empty:
+                continue
+
+            if line is None:
+                raise ValueError('Emulator exited before logging profiler results (target: ' + target.name + ')')
+
+            profiler_match = profiler_regex.search(line.rstrip())
+
+            if profiler_match:
+                profiler_line = profiler_match.group(1)
+                profiler_lines.append(profiler_line)
+
+                if profiler_line == 'profiler: end':
+                    return profiler_lines
+    finally:
+        process.kill()
+        process.wait()
+
+
+def parse_profiler_lines(lines):
+    entry_regex = re.compile(r'^profiler: (.+) (-?\d+) (-?\d+)$')
+    entries = None
+
+    for line in lines:
+        if line == 'profiler: begin':
+            entries = {}
+        elif line == 'profiler: end':
+            if entries is not None:
+                return entries
+        elif entries is not None:
+            entry_match = entry_regex.match(line)
+
+            if entry_match:
+                entries[entry_match.group(1)] = {
+                    'total': int(entry_match.group(2)),
+                    'max': int(entry_match.group(3)),
+                }
+
+    raise ValueError('Profiler results not found')
+
+
+def compare_results(target_name, results, baseline, threshold):
+    regressions = 0
+    print('{:<40} {:>14} {:>14} {:>9}'.format(target_name, 'baseline', 'current', 'diff %'))
+
+    for entry_id in sorted(set(baseline) | set(results)):
+        baseline_entry = baseline.get(entry_id)
+        results_entry = results.get(entry_id)
+
+        if baseline_entry is None:
+            print('{:<40} {:>14} {:>14} {:>9}'.format(entry_id, '-', results_entry['total'], 'new'))
+        elif results_entry is None:
+            print('{:<40} {:>14} {:>14} {:>9}'.format(entry_id, baseline_entry['total'], '-', 'missing'))
+            regressions += 1
+        else:
+            baseline_total = baseline_entry['total']
+            results_total = results_entry['total']
+            diff = (results_total - baseline_total) * 100 / max(baseline_total, 1)
+            status = ''
+
+            if diff > threshold:
+                status = ' REGRESSION'
+                regressions += 1
+
+            print('{:<40} {:>14} {:>14} {:>+9.2f}{}'.format(entry_id, baseline_total, results_total, diff, status))
+
+    print('')
+    return regressions
+
+
+def process_profiler_harness(args):
+    config_file_path = os.path.abspath(args.config)
+    config_folder_path = os.path.dirname(config_file_path)
+
+    with open(config_file_path, 'r') as config_file:
+        config = json.load(config_file)
+
+    baselines_folder_path = os.path.join(config_folder_path, config.get('baselines', 'baselines'))
+    targets = [Target(config_folder_path, info) for info in config['targets']]
+
+    if args.targets:
+        target_names = set(args.targets)
+        targets = [target for target in targets if target.name in target_names]
+
+        if len(targets) != len(target_names):
+            raise ValueError('Targets not found: ' + str(target_names - set(target.name for target in targets)))
+
+    mgba_args = shlex.split(args.mgba_args)
+    regressions = 0
+
+    for target in targets:
+        if not args.no_build:
+            print('Building ' + target.name + '...')
+            target.build(args.make, args.jobs)
+
+        print('Running ' + target.name + '...')
+        results = parse_profiler_lines(run_target(target, args.mgba, mgba_args))
+        results_json = {
+            'target': target.name,
+            'frames': target.frames,
+            'entries': results,
+        }
+
+        if args.output is not None:
+            os.makedirs(args.output, exist_ok=True)
+
+            with open(os.path.join(args.output, target.name + '.json'), 'w') as output_file:
+                json.dump(results_json, output_file, indent=4, sort_keys=True)
+
+        baseline_file_path = os.path.join(baselines_folder_path, target.name + '.json')
+
+        if args.update_baselines:
+            os.makedirs(baselines_folder_path, exist_ok=True)
+
+            with open(baseline_file_path, 'w') as baseline_file:
+                json.dump(results_json, baseline_file, indent=4, sort_keys=True)
+
+            print('Baseline updated: ' + baseline_file_path)
+        elif os.path.isfile(baseline_file_path):
+            with open(baseline_file_path, 'r') as baseline_file:
+                baseline = json.load(baseline_file)['entries']
+
+            regressions += compare_results(target.name, results, baseline, args.threshold)
+        else:
+            print('Baseline not found: ' + baseline_file_path)
+
+    if regressions:
+        raise ValueError(str(regressions) + ' profiler regressions found')
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description='Butano headless profiler harness.')
+    parser.add_argument('--config', required=True, help='targets JSON file path')
+    parser.add_argument('--targets', nargs='*', help='names of the targets to run (all of them by default)')
+    parser.add_argument('--mgba', default='mgba-rom-test', help='headless mGBA executable path')
+    parser.add_argument('--mgba-args', default='', help='additional headless mGBA arguments')
+    parser.add_argument('--make', default='make', help='make executable path')
+    parser.add_argument('--jobs', type=int, default=os.cpu_count() or 1, help='number of parallel build jobs')
+    parser.add_argument('--no-build', action='store_true', help='run already built targets')
+    parser.add_argument('--threshold', type=float, default=5, help='maximum allowed total ticks increase (%%)')
+    parser.add_argument('--output', help='results JSON files output folder path')
+    parser.add_argument('--update-baselines', action='store_true', help='replace baselines with the new results')
+
+    try:
+        process_profiler_harness(parser.parse_args())
+    except Exception as ex:
+        sys.stderr.write('Error: ' + str(ex) + '\n')
+        traceback.print_exc()
+        exit(-1)
@@ -0,0 +1,135 @@
+"""
+Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+zlib License, see LICENSE file.
+"""
+
+import argparse
+import bisect
+import os
+import re
+import subprocess
+import sys
+import traceback
+
+
+def _nm_path(nm):
+    if nm is not None:
+        return nm
+
+    devkitarm = os.environ.get('DEVKITARM')
+
+    if devkitarm:
+        return os.path.join(devkitarm, 'bin', 'arm-none-eabi-nm')
+
+    wonderful_toolchain = os.environ.get('WONDERFUL_TOOLCHAIN')
+
+    if wonderful_toolchain:
+        return os.path.join(wonderful_toolchain, 'toolchain', 'gcc-arm-none-eabi', 'bin', 'arm-none-eabi-nm')
+
+    return 'arm-none-eabi-nm'
+
+
+def read_symbols(elf_file_path, nm):
+    command = [_nm_path(nm), '--demangle', '--print-size', '--numeric-sort', '--defined-only', elf_file_path]
+    output = subprocess.run(command, capture_output=True, text=True, check=True).stdout
+    symbol_regex = re.compile(r'^([0-9a-fA-F]+) ([0-9a-fA-F]+) [TtWw] (.+)$')
+    symbols = []
+
+    for line in output.splitlines():
+        symbol_match = symbol_regex.match(line)
+
+        if symbol_match:
+            address = int(symbol_match.group(1), 16) & ~1
+            size = int(symbol_match.group(2), 16)
+
+            if size > 0:
+                symbols.append([address, size, symbol_match.group(3)])
+
+    symbols.sort(key=lambda symbol: symbol[0])
+    return symbols
+
+
+def read_samples(log_file_path):
+    sample_regex = re.compile(r'sampling_profiler: (0x[0-9a-fA-F]+) (\d+)\s*$')
+    samples = {}
+
+    with open(log_file_path, 'r') as log_file:
+        for line in log_file:
+            sample_match = sample_regex.search(line)
+
+            if sample_match:
+                address = int(sample_match.group(1), 16)
+                samples[address] = samples.get(address, 0) + int(sample_match.group(2))
+
+    return samples
+
+
+def region_name(address):
+    if address < 0x02000000:
+        return '[BIOS]'
+
+    if address < 0x03000000:
+        return '[EWRAM]'
+
+    if address < 0x04000000:
+        return '[IWRAM]'
+
+    return '[ROM]'
+
+
+def symbolize(symbols, samples):
+    starts = [symbol[0] for symbol in symbols]
+    hits = {}
+
+    for address, count in samples.items():
+        index = bisect.bisect_right(starts, address) - 1
+
+        if index >= 0 and address < symbols[index][0] + symbols[index][1]:
+            name = symbols[index][2]
+        else:
+            name = region_name(address) + ' unknown'
+
+        hits[name] = hits.get(name, 0) + count
+
+    result = list(hits.items())
+    result.sort(key=lambda hit: hit[1], reverse=True)
+    return result
+
+
+def process_sampling_profiler(args):
+    samples = read_samples(args.log)
+
+    if not samples:
+        raise ValueError('No samples found in log file: ' + args.log)
+
+    symbols = read_symbols(args.elf, args.nm)
+    hits = symbolize(symbols, samples)
+    total_samples = sum(samples.values())
+
+    print('Sampling profiler results (' + str(total_samples) + ' samples)')
+    print('')
+    print('{:>8} {:>8}  {}'.format('samples', '%', 'function'))
+
+    for name, count in hits[:args.max_rows]:
+        print('{:>8} {:>8.2f}  {}'.format(count, count * 100 / total_samples, name))
+
+    if args.output is not None:
+        with open(args.output, 'w') as output_file:
+            for address in sorted(samples):
+                output_file.write(hex(address) + ' ' + str(samples[address]) + '\n')
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description='Butano sampling profiler results symbolizer.')
+    parser.add_argument('--elf', required=True, help='ROM ELF file path')
+    parser.add_argument('--log', required=True, help='bn::sampling_profiler::log output file path')
+    parser.add_argument('--nm', help='nm executable path')
+    parser.add_argument('--max-rows', type=int, default=40, help='maximum number of functions to print')
+    parser.add_argument('--output', help='merged samples output file path (address and hits count per line)')
+
+    try:
+        process_sampling_profiler(parser.parse_args())
+    except Exception as ex:
+        sys.stderr.write('Error: ' + str(ex) + '\n')
+        traceback.print_exc()
+        exit(-1)
@@ -16,6 +16,9 @@ CFLAGS      :=	$(CWARNINGS) -gdwarf-4 -O2 -mcpu=arm7tdmi -mtune=arm7tdmi -ffast-
 CFLAGS      +=	$(INCLUDE)
 CFLAGS      +=	$(USERFLAGS)
 
+# EXTRAFLAGS allows to add compiler flags from the command line without replacing USERFLAGS:
+CFLAGS      +=	$(EXTRAFLAGS)
+
 CPPWARNINGS	:=	-Wuseless-cast -Wnon-virtual-dtor -Woverloaded-virtual
 CXXFLAGS    :=	$(CFLAGS) $(CPPWARNINGS) -std=c++20 -fno-rtti -fno-exceptions -fno-threadsafe-statics \
 				-fuse-cxa-atexit $(USERCXXFLAGS)
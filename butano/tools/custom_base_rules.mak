@@ -15,6 +15,23 @@ ifdef ADD_COMPILE_COMMAND
 endif
 	$(SILENTCMD)$(CC) -MMD -MP -MF $(DEPSDIR)/$*.bn_iwram.d $(CPPFLAGS) $(CFLAGS) -fno-lto -marm -mlong-calls -c $< -o $@ $(ERROR_FILTER)
 	
+#---------------------------------------------------------------------------------------------------------------------
+# Butano custom IWRAM overlay base rules without flto:
+#---------------------------------------------------------------------------------------------------------------------
+%.bn_iwram_overlay.o: %.bn_iwram_overlay.cpp
+	$(SILENTMSG) $(notdir $<)
+ifdef ADD_COMPILE_COMMAND
+	$(ADD_COMPILE_COMMAND) add $(CXX) "$(CPPFLAGS) $(CXXFLAGS) -fno-lto -marm -mlong-calls -c $< -o $@" $<
+endif
+	$(SILENTCMD)$(CXX) -MMD -MP -MF $(DEPSDIR)/$*.bn_iwram_overlay.d $(CPPFLAGS) $(CXXFLAGS) -fno-lto -marm -mlong-calls -c $< -o $@ $(ERROR_FILTER)
+
+%.bn_iwram_overlay.o: %.bn_iwram_overlay.c
+	$(SILENTMSG) $(notdir $<)
+ifdef ADD_COMPILE_COMMAND
+	$(ADD_COMPILE_COMMAND) add $(CC) "$(CPPFLAGS) $(CFLAGS) -fno-lto -marm -mlong-calls -c $< -o $@" $<
+endif
+	$(SILENTCMD)$(CC) -MMD -MP -MF $(DEPSDIR)/$*.bn_iwram_overlay.d $(CPPFLAGS) $(CFLAGS) -fno-lto -marm -mlong-calls -c $< -o $@ $(ERROR_FILTER)
+
 #---------------------------------------------------------------------------------------------------------------------
 # Butano custom EWRAM base rules without flto:
 #---------------------------------------------------------------------------------------------------------------------
@@ -3,6 +3,7 @@ Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
 zlib License, see LICENSE file.
 """
 
+import hashlib
 import os
 import string
 
@@ -58,9 +59,13 @@ class FileInfo:
     def build_from_files(file_paths):
         info = []
 
+        # Contents are hashed instead of checking modification times,
+        # so checkouts and branch switches don't trigger rebuilds of unchanged files:
         for file_path in file_paths:
             info.append(file_path)
-            info.append(str(os.path.getmtime(file_path)))
+
+            with open(file_path, 'rb') as file:
+                info.append(hashlib.sha1(file.read()).hexdigest())
 
         return FileInfo('\n'.join(info), False)
 
@@ -0,0 +1,156 @@
+"""
+Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+zlib License, see LICENSE file.
+"""
+
+import heapq
+from collections import Counter
+
+
+def _align_4(size):
+    return (size + 3) & ~3
+
+
+def lz77_compressed_size(data):
+    """
+    Returns the size in bytes of the given data compressed in the GBA BIOS LZ77 format, header included.
+
+    Longest matches are selected greedily like grit does, and they are never taken from the previous byte,
+    so the compressed data can be decompressed to VRAM.
+    """
+
+    data_size = len(data)
+    matches = _lz77_matches(data)
+    tokens = []
+    index = 0
+
+    while index < data_size:
+        length = max(matches[index], 1)
+        tokens.append(length)
+        index += length
+
+    flags_size = (len(tokens) + 7) // 8
+    tokens_size = sum(2 if length >= 3 else 1 for length in tokens)
+    return _align_4(4 + flags_size + tokens_size)
+
+
+def _lz77_matches(data):
+    # Longest match length (or 0 if there's no valid match) for each position of the data:
+    data_size = len(data)
+    result = [0] * data_size
+    positions = {}
+
+    for index in range(data_size - 2):
+        key = data[index:index + 3]
+        key_positions = positions.get(key)
+
+        if key_positions is None:
+            positions[key] = [index]
+            continue
+
+        max_length = min(18, data_size - index)
+        best_length = 0
+
+        for position in reversed(key_positions):
+            distance = index - position
+
+            if distance > 4096:
+                break
+
+            if distance < 2:
+                continue
+
+            length = 3
+
+            while length < max_length and data[position + length] == data[index + length]:
+                length += 1
+
+            if length > best_length:
+                best_length = length
+
+                if length == max_length:
+                    break
+
+        result[index] = best_length
+        key_positions.append(index)
+
+    return result
+
+
+def run_length_compressed_size(data):
+    """
+    Returns the size in bytes of the given data compressed in the GBA BIOS run-length format, header included.
+    """
+
+    data_size = len(data)
+    size = 4
+    literals_count = 0
+    index = 0
+
+    while index < data_size:
+        value = data[index]
+        run_length = 1
+
+        while run_length < 130 and index + run_length < data_size and data[index + run_length] == value:
+            run_length += 1
+
+        if run_length >= 3:
+            if literals_count:
+                size += 1 + literals_count
+                literals_count = 0
+
+            size += 2
+            index += run_length
+        else:
+            literals_count += 1
+            index += 1
+
+            if literals_count == 128:
+                size += 1 + literals_count
+                literals_count = 0
+
+    if literals_count:
+        size += 1 + literals_count
+
+    return _align_4(size)
+
+
+def huffman_compressed_size(data):
+    """
+    Returns the size in bytes of the given data compressed in the GBA BIOS 8-bit Huffman format, header included.
+    """
+
+    frequencies = list(Counter(data).values())
+    leaves_count = max(len(frequencies), 2)
+
+    if len(frequencies) > 1:
+        # The number of bits of the encoded data is the sum of the weights of the internal nodes of the tree:
+        heapq.heapify(frequencies)
+        bits_count = 0
+
+        while len(frequencies) > 1:
+            weight = heapq.heappop(frequencies) + heapq.heappop(frequencies)
+            bits_count += weight
+            heapq.heappush(frequencies, weight)
+    else:
+        bits_count = len(data)
+
+    # Tree size byte plus tree nodes, and then the encoded data in 32-bit words:
+    tree_size = _align_4(1 + (leaves_count * 2) - 1)
+    return 4 + tree_size + (((bits_count + 31) // 32) * 4)
+
+
+def compressed_size(compression, data):
+    if compression == 'none':
+        return _align_4(len(data))
+
+    if compression == 'lz77':
+        return lz77_compressed_size(data)
+
+    if compression == 'run_length':
+        return run_length_compressed_size(data)
+
+    if compression == 'huffman':
+        return huffman_compressed_size(data)
+
+    raise ValueError('Unknown compression: ' + str(compression))
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BATCH_MATH_TESTS_H
+#define BATCH_MATH_TESTS_H
+
+#include "bn_batch_math.h"
+#include "tests.h"
+
+class batch_math_tests : public tests
+{
+
+public:
+    batch_math_tests() :
+        tests("batch_math")
+    {
+        bn::fixed_point points[] = { bn::fixed_point(1, 2), bn::fixed_point(-3, 0.5) };
+        bn::batch_math::transform(2, 0, 0, -1, bn::fixed_point(10, 20), points, points);
+        BN_ASSERT(points[0] == bn::fixed_point(12, 18));
+        BN_ASSERT(points[1] == bn::fixed_point(4, 19.5));
+
+        bn::batch_math::scale(0.5, points, points);
+        BN_ASSERT(points[0] == bn::fixed_point(6, 9));
+
+        bn::batch_math::rotate(90, points, points);
+        BN_ASSERT(points[0] == bn::fixed_point(-9, 6));
+
+        bn::fixed_point velocities[] = { bn::fixed_point(1, 1), bn::fixed_point(-2, 4) };
+        bn::batch_math::multiply_add(0.25, velocities, points);
+        BN_ASSERT(points[0] == bn::fixed_point(-8.75, 6.25));
+
+        bn::fixed matrix[] = { 0, -1, 0, 1, 0, 0, 0, 0, 2 };
+        bn::fixed xs[] = { 1, 2 };
+        bn::fixed ys[] = { 3, 4 };
+        bn::fixed zs[] = { 5, -6 };
+        bn::batch_math::transform(matrix, xs, ys, zs, xs, ys, zs);
+        BN_ASSERT(xs[0] == -3 && ys[0] == 1 && zs[0] == 10);
+        BN_ASSERT(xs[1] == -4 && ys[1] == 2 && zs[1] == -12);
+
+        bn::fixed a[] = { 1, 2, 3 };
+        bn::fixed b[] = { 4, -5, 0.5 };
+        BN_ASSERT(bn::batch_math::dot(a, b) == -4.5);
+
+        int values[] = { 1, -4, 2048 };
+        bn::fixed_t<16> reciprocals[3];
+        bn::batch_math::reciprocal(values, reciprocals);
+        BN_ASSERT(reciprocals[0] == 1);
+        BN_ASSERT(reciprocals[1] == -0.25);
+        BN_ASSERT(reciprocals[2].data() == 32);
+    }
+};
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BG_TEXT_GENERATOR_TESTS_H
+#define BG_TEXT_GENERATOR_TESTS_H
+
+#include "bn_unique_ptr.h"
+#include "bn_bg_text_generator.h"
+#include "tests.h"
+
+#include "common_variable_8x16_sprite_font.h"
+
+class bg_text_generator_tests : public tests
+{
+
+public:
+    bg_text_generator_tests() :
+        tests("bg_text_generator")
+    {
+        bn::unique_ptr<bn::bg_text_generator> text_generator =
+                bn::make_unique<bn::bg_text_generator>(common::variable_8x16_sprite_font);
+        BN_ASSERT(text_generator->used_tiles_count() == 1);
+
+        text_generator->print(0, 0, "Score: 1000");
+
+        int score_tiles_count = text_generator->used_tiles_count();
+        BN_ASSERT(score_tiles_count > 1);
+        BN_ASSERT(text_generator->last_updated_tiles_count() == score_tiles_count - 1);
+        BN_ASSERT(text_generator->last_updated_rows_count() > 0);
+
+        // Reprinting the same text doesn't copy anything:
+        text_generator->print(0, 0, "Score: 1000");
+        BN_ASSERT(text_generator->used_tiles_count() == score_tiles_count);
+        BN_ASSERT(text_generator->last_updated_tiles_count() == 0);
+        BN_ASSERT(text_generator->last_updated_rows_count() == 0);
+
+        // Only the tiles of the changed characters are copied:
+        text_generator->print(0, 0, "Score: 1001");
+        BN_ASSERT(text_generator->last_updated_tiles_count() > 0);
+        BN_ASSERT(text_generator->last_updated_tiles_count() < score_tiles_count - 1);
+        BN_ASSERT(text_generator->last_updated_rows_count() > 0);
+
+        text_generator->clear(0);
+        BN_ASSERT(text_generator->used_tiles_count() == 1);
+        BN_ASSERT(text_generator->last_updated_tiles_count() == 0);
+        BN_ASSERT(text_generator->last_updated_rows_count() > 0);
+
+        // Released tiles are taken back if they have not been reused:
+        text_generator->print(0, 0, "Score: 1001");
+        BN_ASSERT(text_generator->last_updated_tiles_count() == 0);
+        BN_ASSERT(text_generator->last_updated_rows_count() > 0);
+
+        text_generator->clear();
+        text_generator->print(0, 0, "Hi: 99999999");
+
+        int hi_score_tiles_count = text_generator->used_tiles_count();
+        text_generator.reset();
+
+        // Reprinting a line doesn't need the tiles of both the old and the new text:
+        text_generator = bn::make_unique<bn::bg_text_generator>(
+                    common::variable_8x16_sprite_font, bn::max(score_tiles_count, hi_score_tiles_count));
+        text_generator->print(0, 0, "Score: 1000");
+        text_generator->print(0, 0, "Hi: 99999999");
+        BN_ASSERT(text_generator->used_tiles_count() == hi_score_tiles_count);
+
+        text_generator->print(0, 0, "Score: 1000");
+        BN_ASSERT(text_generator->used_tiles_count() == score_tiles_count);
+    }
+};
+
+#endif
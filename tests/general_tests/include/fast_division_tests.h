@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef FAST_DIVISION_TESTS_H
+#define FAST_DIVISION_TESTS_H
+
+#include "bn_math.h"
+#include "bn_random.h"
+#include "bn_fast_divider.h"
+#include "tests.h"
+
+class fast_division_tests : public tests
+{
+
+public:
+    fast_division_tests() :
+        tests("fast_division")
+    {
+        static_assert(bn::fast_divider(7).divide(100) == 14);
+        static_assert(bn::fast_divider(-7).divide(100) == -14);
+        static_assert(bn::fast_divider(7).divide(-100) == -14);
+        static_assert(bn::fast_divider(1).divide(bn::numeric_limits<int>::max()) == bn::numeric_limits<int>::max());
+        static_assert(bn::fast_divider(bn::numeric_limits<int>::min()).divide(bn::numeric_limits<int>::min()) == 1);
+        static_assert(bn::fixed(10) / bn::fast_divider(4) == 2.5);
+
+        static_assert(bn::fast_division(bn::fixed(3), bn::fixed(2)) == 1.5);
+        static_assert(bn::fast_division(bn::fixed(-3), bn::fixed(0.5)) == -6);
+        static_assert(bn::fast_division(bn::fixed(1), bn::fixed(3)) == bn::fixed(1).safe_division(3));
+
+        constexpr int divisors[] = {
+            1, 2, 3, 5, 6, 7, 10, 25, 100, 641, 4095, 4096, 4097, 65535, 65537, 123456789,
+            bn::numeric_limits<int>::max(), bn::numeric_limits<int>::min()
+        };
+
+        bn::random random;
+
+        for(int divisor : divisors)
+        {
+            bn::fast_divider divider(divisor);
+
+            for(int it = 0; it < 64; ++it)
+            {
+                int value = int(random.get());
+                BN_ASSERT(divider.divide(value) == value / divisor, value, " / ", divisor);
+                BN_ASSERT((value / divider) == value / divisor, value, " / ", divisor);
+            }
+
+            if(divisor != bn::numeric_limits<int>::min())
+            {
+                bn::fast_divider negative_divider(-divisor);
+
+                for(int it = 0; it < 64; ++it)
+                {
+                    int value = int(random.get());
+                    BN_ASSERT(negative_divider.divide(value) == value / -divisor, value, " / ", -divisor);
+                }
+            }
+        }
+
+        for(int it = 0; it < 1024; ++it)
+        {
+            int dividend_data = int(random.get()) >> random.get_int(32);
+            int divisor_data = int(random.get()) >> random.get_int(32);
+
+            if(divisor_data)
+            {
+                int64_t expected = (int64_t(dividend_data) * bn::fixed::scale()) / divisor_data;
+
+                if(bn::abs(expected) < bn::numeric_limits<int>::max())
+                {
+                    int result = bn::fast_division(bn::fixed::from_data(dividend_data),
+                                                   bn::fixed::from_data(divisor_data)).data();
+                    int ulps = int(bn::abs(result - expected));
+                    BN_ASSERT(ulps <= bn::abs(expected) >> 18, dividend_data, " / ", divisor_data, ": ", ulps);
+                }
+            }
+        }
+    }
+};
+
+#endif
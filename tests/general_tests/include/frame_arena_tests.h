@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef FRAME_ARENA_TESTS_H
+#define FRAME_ARENA_TESTS_H
+
+#include "bn_core.h"
+#include "bn_alignment.h"
+#include "bn_frame_arena.h"
+#include "tests.h"
+
+class frame_arena_tests : public tests
+{
+
+public:
+    frame_arena_tests() :
+        tests("frame_arena")
+    {
+        bn::core::update();
+        bn::frame_arena::reset_max_used();
+
+        BN_ASSERT(bn::frame_arena::used_iwram() == 0);
+        BN_ASSERT(bn::frame_arena::used_ewram() == 0);
+        BN_ASSERT(bn::frame_arena::available_iwram() == BN_CFG_FRAME_ARENA_IWRAM_BYTES);
+        BN_ASSERT(bn::frame_arena::available_ewram() == BN_CFG_FRAME_ARENA_EWRAM_BYTES);
+
+        void* ptr = bn::frame_arena::ewram_alloc(3, 1);
+        BN_ASSERT(ptr);
+        BN_ASSERT(bn::frame_arena::used_ewram() == 3);
+
+        ptr = bn::frame_arena::ewram_alloc(4);
+        BN_ASSERT(bn::aligned<4>(ptr));
+        BN_ASSERT(bn::frame_arena::used_ewram() == 8);
+
+        bn::span<int> ints = bn::frame_arena::ewram_span<int>(4);
+        BN_ASSERT(ints.size() == 4);
+        BN_ASSERT(ints[0] == 0 && ints[3] == 0);
+        BN_ASSERT(bn::frame_arena::used_ewram() == 24);
+
+        bn::span<uint16_t> half_words = bn::frame_arena::iwram_span<uint16_t>(3);
+        BN_ASSERT(half_words.size() == 3);
+        BN_ASSERT(bn::frame_arena::used_iwram() == 6);
+
+        bn::core::update();
+        BN_ASSERT(bn::frame_arena::used_iwram() == 0);
+        BN_ASSERT(bn::frame_arena::used_ewram() == 0);
+        BN_ASSERT(bn::frame_arena::max_used_iwram() == 6);
+        BN_ASSERT(bn::frame_arena::max_used_ewram() == 24);
+
+        bn::frame_arena::reset_max_used();
+        BN_ASSERT(bn::frame_arena::max_used_iwram() == 0);
+        BN_ASSERT(bn::frame_arena::max_used_ewram() == 0);
+    }
+};
+
+#endif
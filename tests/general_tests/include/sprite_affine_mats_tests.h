@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef SPRITE_AFFINE_MATS_TESTS_H
+#define SPRITE_AFFINE_MATS_TESTS_H
+
+#include "bn_sprite_ptr.h"
+#include "bn_sprite_affine_mats.h"
+#include "bn_sprite_affine_mat_ptr.h"
+#include "bn_affine_mat_attributes.h"
+#include "tests.h"
+
+#include "common_variable_8x16_sprite_font.h"
+
+class sprite_affine_mats_tests : public tests
+{
+
+public:
+    sprite_affine_mats_tests() :
+        tests("sprite_affine_mats")
+    {
+        int used_count = bn::sprite_affine_mats::used_count();
+
+        bn::affine_mat_attributes attributes;
+        attributes.set_rotation_angle(45);
+        attributes.set_scale(1.5);
+
+        bn::affine_mat_attributes similar_attributes = attributes;
+        similar_attributes.set_rotation_angle(45.5);
+        similar_attributes.set_scale(1.51);
+
+        bn::affine_mat_attributes other_attributes = attributes;
+        other_attributes.set_rotation_angle(90);
+
+        bn::sprite_affine_mat_ptr mat = bn::sprite_affine_mat_ptr::create_shared(attributes);
+        bn::sprite_affine_mat_ptr similar_mat = bn::sprite_affine_mat_ptr::create_shared(similar_attributes);
+        bn::sprite_affine_mat_ptr other_mat = bn::sprite_affine_mat_ptr::create_shared(other_attributes);
+        BN_ASSERT(mat.shared());
+        BN_ASSERT(mat == similar_mat);
+        BN_ASSERT(mat != other_mat);
+        BN_ASSERT(bn::sprite_affine_mats::shared_count() == 2);
+        BN_ASSERT(bn::sprite_affine_mats::used_count() == used_count + 2);
+
+        other_mat.set_rotation_angle(180);
+        BN_ASSERT(! other_mat.shared());
+        BN_ASSERT(bn::sprite_affine_mats::shared_count() == 1);
+
+        bn::sprite_affine_mat_ptr new_other_mat = bn::sprite_affine_mat_ptr::create_shared(other_attributes);
+        BN_ASSERT(new_other_mat != other_mat);
+        BN_ASSERT(bn::sprite_affine_mats::shared_count() == 2);
+
+        _sprite_tests();
+    }
+
+private:
+    static void _sprite_tests()
+    {
+        const bn::sprite_item& sprite_item = common::variable_8x16_sprite_font.item();
+        int shared_count = bn::sprite_affine_mats::shared_count();
+
+        bn::affine_mat_attributes attributes;
+        attributes.set_rotation_angle(22.5);
+
+        // sprite_ptr setters replace shared matrices used by other sprites instead of modifying them:
+        bn::sprite_ptr sprite = sprite_item.create_sprite(0, 0);
+        bn::sprite_ptr other_sprite = sprite_item.create_sprite(0, 0);
+        sprite.set_affine_mat(bn::sprite_affine_mat_ptr::create_shared(attributes));
+        other_sprite.set_affine_mat(*sprite.affine_mat());
+        BN_ASSERT(bn::sprite_affine_mats::shared_count() == shared_count + 1);
+
+        sprite.set_rotation_angle(90);
+        BN_ASSERT(sprite.affine_mat()->shared());
+        BN_ASSERT(sprite.affine_mat() != other_sprite.affine_mat());
+        BN_ASSERT(sprite.affine_mat()->rotation_angle() == 90);
+        BN_ASSERT(other_sprite.affine_mat()->shared());
+        BN_ASSERT(other_sprite.affine_mat()->rotation_angle() == 22.5);
+        BN_ASSERT(bn::sprite_affine_mats::shared_count() == shared_count + 2);
+
+        // A shared matrix used only by one sprite is modified in place:
+        int mat_id = other_sprite.affine_mat()->id();
+        other_sprite.set_scale(2);
+        BN_ASSERT(other_sprite.affine_mat()->id() == mat_id);
+        BN_ASSERT(other_sprite.affine_mat()->shared());
+        BN_ASSERT(other_sprite.affine_mat()->horizontal_scale() == 2);
+        BN_ASSERT(bn::sprite_affine_mats::shared_count() == shared_count + 2);
+
+        // If there's already a shared matrix with the new attributes, it is used instead:
+        other_sprite.set_scale(1);
+        other_sprite.set_rotation_angle(90);
+        BN_ASSERT(other_sprite.affine_mat() == sprite.affine_mat());
+        BN_ASSERT(bn::sprite_affine_mats::shared_count() == shared_count + 1);
+
+        // Non shared matrices are modified in place:
+        sprite.set_affine_mat(bn::sprite_affine_mat_ptr::create(attributes));
+        mat_id = sprite.affine_mat()->id();
+        sprite.set_rotation_angle(45);
+        BN_ASSERT(! sprite.affine_mat()->shared());
+        BN_ASSERT(sprite.affine_mat()->id() == mat_id);
+        BN_ASSERT(sprite.affine_mat()->rotation_angle() == 45);
+
+        sprite.remove_affine_mat();
+        other_sprite.remove_affine_mat();
+        BN_ASSERT(bn::sprite_affine_mats::shared_count() == shared_count);
+
+        // Matrices created by sprite_ptr setters are shared only if shared_by_default is enabled:
+        BN_ASSERT(! bn::sprite_affine_mats::shared_by_default());
+        sprite.set_rotation_angle(22.5);
+        other_sprite.set_rotation_angle(22.5);
+        BN_ASSERT(! sprite.affine_mat()->shared());
+        BN_ASSERT(sprite.affine_mat() != other_sprite.affine_mat());
+
+        sprite.remove_affine_mat();
+        other_sprite.remove_affine_mat();
+        bn::sprite_affine_mats::set_shared_by_default(true);
+        sprite.set_rotation_angle(22.5);
+        other_sprite.set_rotation_angle(22.5);
+        BN_ASSERT(sprite.affine_mat()->shared());
+        BN_ASSERT(sprite.affine_mat() == other_sprite.affine_mat());
+        BN_ASSERT(bn::sprite_affine_mats::shared_count() == shared_count + 1);
+
+        bn::sprite_affine_mats::set_shared_by_default(false);
+    }
+};
+
+#endif
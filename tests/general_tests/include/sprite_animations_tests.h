@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef SPRITE_ANIMATIONS_TESTS_H
+#define SPRITE_ANIMATIONS_TESTS_H
+
+#include "bn_core.h"
+#include "bn_sprite_ptr.h"
+#include "bn_sprite_animations.h"
+#include "bn_sprite_animation_ptr.h"
+#include "tests.h"
+
+#include "common_variable_8x16_sprite_font.h"
+
+class sprite_animations_tests : public tests
+{
+
+public:
+    sprite_animations_tests() :
+        tests("sprite_animations")
+    {
+        const bn::sprite_item& sprite_item = common::variable_8x16_sprite_font.item();
+        bn::sprite_ptr sprite = sprite_item.create_sprite(0, -64);
+        int used_items_count = bn::sprite_animations::used_items_count();
+
+        constexpr uint16_t graphics_indexes[] = { 1, 2, 3 };
+        bn::sprite_animation_ptr once = bn::sprite_animation_ptr::once(
+                    sprite, 1, sprite_item.tiles_item(), graphics_indexes);
+        bn::sprite_animation_ptr forever = bn::sprite_animation_ptr::forever(
+                    sprite_item.create_sprite(0, 64), 0, sprite_item.tiles_item(), graphics_indexes);
+        BN_ASSERT(bn::sprite_animations::used_items_count() == used_items_count + 2);
+        BN_ASSERT(once.sprite() == sprite);
+        BN_ASSERT(once.frames_count() == 3);
+        BN_ASSERT(! once.update_forever());
+        BN_ASSERT(forever.update_forever());
+
+        for(int index = 0; index < 6; ++index)
+        {
+            bn::core::update();
+        }
+
+        BN_ASSERT(once.done());
+        BN_ASSERT(sprite.tiles() == sprite_item.tiles_item().create_tiles(3));
+        BN_ASSERT(! forever.done());
+        BN_ASSERT(forever.current_index() == 0);
+
+        once.reset();
+        BN_ASSERT(! once.done());
+        BN_ASSERT(once.current_index() == 0);
+
+        bn::sprite_animation_ptr once_copy = once;
+        BN_ASSERT(bn::sprite_animations::used_items_count() == used_items_count + 2);
+    }
+};
+
+#endif
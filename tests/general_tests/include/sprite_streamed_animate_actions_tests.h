@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef SPRITE_STREAMED_ANIMATE_ACTIONS_TESTS_H
+#define SPRITE_STREAMED_ANIMATE_ACTIONS_TESTS_H
+
+#include "bn_core.h"
+#include "bn_sprite_ptr.h"
+#include "bn_sprite_tiles_ptr.h"
+#include "bn_sprite_animate_actions.h"
+#include "tests.h"
+
+#include "common_variable_8x16_sprite_font.h"
+
+class sprite_streamed_animate_actions_tests : public tests
+{
+
+public:
+    sprite_streamed_animate_actions_tests() :
+        tests("sprite_streamed_animate_actions")
+    {
+        const bn::sprite_item& sprite_item = common::variable_8x16_sprite_font.item();
+        const bn::sprite_tiles_item& tiles_item = sprite_item.tiles_item();
+        bn::sprite_ptr sprite = sprite_item.create_sprite(0, -64);
+
+        // Frames are copied to two tile buffers alternately:
+        bn::sprite_streamed_animate_action<3> once = bn::create_sprite_streamed_animate_action_once(
+                    sprite, 0, tiles_item, 1, 2, 3);
+        BN_ASSERT(! once.update_forever());
+        BN_ASSERT(! once.done());
+
+        _update(once);
+
+        bn::sprite_tiles_ptr first_tiles = sprite.tiles();
+        BN_ASSERT(once.current_index() == 1);
+        BN_ASSERT(_tiles_equal(first_tiles, tiles_item, 1));
+
+        _update(once);
+
+        bn::sprite_tiles_ptr second_tiles = sprite.tiles();
+        BN_ASSERT(second_tiles != first_tiles);
+        BN_ASSERT(_tiles_equal(second_tiles, tiles_item, 2));
+
+        _update(once);
+        BN_ASSERT(sprite.tiles() == first_tiles);
+        BN_ASSERT(_tiles_equal(first_tiles, tiles_item, 3));
+        BN_ASSERT(once.done());
+
+        once.reset();
+        BN_ASSERT(! once.done());
+        BN_ASSERT(once.current_index() == 0);
+
+        // Repeated frames don't swap buffers, and wait updates delay frame changes:
+        bn::sprite_streamed_animate_action<3> repeated = bn::create_sprite_streamed_animate_action_once(
+                    sprite, 1, tiles_item, 4, 4, 5);
+        _update(repeated);
+        first_tiles = sprite.tiles();
+        BN_ASSERT(_tiles_equal(first_tiles, tiles_item, 4));
+        BN_ASSERT(repeated.next_change_updates() == 1);
+
+        _update(repeated);
+        BN_ASSERT(repeated.current_index() == 1);
+
+        _update(repeated);
+        BN_ASSERT(sprite.tiles() == first_tiles);
+        BN_ASSERT(repeated.current_index() == 2);
+
+        _update(repeated);
+        _update(repeated);
+        BN_ASSERT(sprite.tiles() != first_tiles);
+        BN_ASSERT(_tiles_equal(sprite.tiles(), tiles_item, 5));
+        BN_ASSERT(repeated.done());
+
+        // Forever actions wrap to the first frame and are never done:
+        bn::sprite_streamed_animate_action<2> forever = bn::create_sprite_streamed_animate_action_forever(
+                    sprite, 0, tiles_item, 6, 7);
+        BN_ASSERT(forever.update_forever());
+
+        for(int index = 0; index < 5; ++index)
+        {
+            _update(forever);
+            BN_ASSERT(! forever.done());
+            BN_ASSERT(forever.current_index() == (index + 1) % 2);
+            BN_ASSERT(_tiles_equal(sprite.tiles(), tiles_item, index % 2 ? 7 : 6));
+        }
+    }
+
+private:
+    // update() must be called at most once per frame:
+    static void _update(bn::isprite_streamed_animate_action& action)
+    {
+        action.update();
+        bn::core::update();
+    }
+
+    [[nodiscard]] static bool _tiles_equal(bn::sprite_tiles_ptr tiles, const bn::sprite_tiles_item& tiles_item,
+                                           int graphics_index)
+    {
+        bn::span<const bn::tile> source_tiles = tiles_item.graphics_tiles_ref(graphics_index);
+        bn::span<bn::tile> vram_tiles = *tiles.vram();
+
+        for(int tile_index = 0, tiles_count = source_tiles.size(); tile_index < tiles_count; ++tile_index)
+        {
+            for(int data_index = 0; data_index < 8; ++data_index)
+            {
+                if(source_tiles[tile_index].data[data_index] != vram_tiles[tile_index].data[data_index])
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+};
+
+#endif
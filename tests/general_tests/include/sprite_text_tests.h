@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef SPRITE_TEXT_TESTS_H
+#define SPRITE_TEXT_TESTS_H
+
+#include "bn_sprite_text.h"
+#include "tests.h"
+
+#include "common_variable_8x16_sprite_font.h"
+
+class sprite_text_tests : public tests
+{
+
+public:
+    sprite_text_tests() :
+        tests("sprite_text")
+    {
+        bn::sprite_text_generator text_generator(common::variable_8x16_sprite_font);
+        bn::sprite_text text(text_generator, bn::fixed_point(0, 64), "Score: 1000");
+        int used_sprites_count = text.used_sprites_count();
+        int full_tiles_count = used_sprites_count * 8;
+        BN_ASSERT(used_sprites_count > 0);
+        BN_ASSERT(text.width() == text_generator.width("Score: 1000"));
+
+        text.set_text("Score: 1000");
+        BN_ASSERT(text.last_updated_tiles_count() == 0);
+
+        text.set_text("Score: 1001");
+        BN_ASSERT(text.last_updated_tiles_count() > 0);
+        BN_ASSERT(text.last_updated_tiles_count() < full_tiles_count);
+        BN_ASSERT(text.used_sprites_count() == used_sprites_count);
+
+        text.set_text("");
+        BN_ASSERT(text.used_sprites_count() == 0);
+        BN_ASSERT(text.width() == 0);
+
+        text.set_text("Score: 1001");
+        BN_ASSERT(text.last_updated_tiles_count() == 0);
+        BN_ASSERT(text.used_sprites_count() == used_sprites_count);
+    }
+};
+
+#endif
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef SPRITE_TILES_TESTS_H
+#define SPRITE_TILES_TESTS_H
+
+#include "bn_core.h"
+#include "bn_optional.h"
+#include "bn_sprite_ptr.h"
+#include "bn_sprite_tiles.h"
+#include "bn_sprite_tiles_ptr.h"
+#include "bn_sprite_palette_ptr.h"
+#include "tests.h"
+
+#include "common_variable_8x16_sprite_font.h"
+
+class sprite_tiles_tests : public tests
+{
+
+public:
+    sprite_tiles_tests() :
+        tests("sprite_tiles")
+    {
+        const bn::sprite_item& sprite_item = common::variable_8x16_sprite_font.item();
+        const bn::sprite_tiles_item& tiles_item = sprite_item.tiles_item();
+        int tiles_count = tiles_item.tiles_count_per_graphic();
+        int compaction_bytes_per_frame = bn::sprite_tiles::compaction_bytes_per_frame();
+        bn::sprite_tiles::set_compaction_bytes_per_frame(0);
+        bn::core::update();
+
+        // Layout: free block, tiles with data, free block, allocated tiles:
+        bn::optional<bn::sprite_tiles_ptr> first_hole = tiles_item.create_tiles(40);
+        bn::sprite_tiles_ptr data_tiles = tiles_item.create_tiles(41);
+        bn::optional<bn::sprite_tiles_ptr> second_hole = bn::sprite_tiles_ptr::allocate(
+                    tiles_count, tiles_item.bpp());
+        bn::sprite_tiles_ptr allocated_tiles = bn::sprite_tiles_ptr::allocate(tiles_count, tiles_item.bpp());
+
+        int first_hole_id = first_hole->id();
+        int data_tiles_id = data_tiles.id();
+        int allocated_tiles_id = allocated_tiles.id();
+        BN_ASSERT(data_tiles_id == first_hole_id + tiles_count, data_tiles_id, " - ", first_hole_id);
+        BN_ASSERT(allocated_tiles_id == data_tiles_id + (tiles_count * 2), allocated_tiles_id, " - ", data_tiles_id);
+
+        bn::sprite_ptr sprite = bn::sprite_ptr::create(0, 0, sprite_item.shape_size(), data_tiles,
+                                                       sprite_item.palette_item().create_palette());
+        first_hole.reset();
+        second_hole.reset();
+        bn::core::update();
+        BN_ASSERT(data_tiles.id() == data_tiles_id);
+        BN_ASSERT(_oam_contains_tiles_id(data_tiles_id));
+
+        // Tiles with data are moved down into freed blocks, allocated tiles are not moved:
+        bn::sprite_tiles::set_compaction_bytes_per_frame(1024);
+        bn::core::update();
+        BN_ASSERT(data_tiles.id() == first_hole_id, data_tiles.id(), " - ", first_hole_id);
+        BN_ASSERT(allocated_tiles.id() == allocated_tiles_id, allocated_tiles.id(), " - ", allocated_tiles_id);
+
+        // The tiles id of the sprite is updated:
+        BN_ASSERT(sprite.tiles() == data_tiles);
+        BN_ASSERT(_oam_contains_tiles_id(first_hole_id));
+        BN_ASSERT(! _oam_contains_tiles_id(data_tiles_id));
+
+        bn::sprite_tiles::set_compaction_bytes_per_frame(compaction_bytes_per_frame);
+    }
+
+private:
+    [[nodiscard]] static bool _oam_contains_tiles_id(int tiles_id)
+    {
+        // Visible sprites are committed to OAM in bn::core::update:
+        auto oam = reinterpret_cast<const volatile uint16_t*>(0x07000000);
+
+        for(int index = 0; index < 128; ++index)
+        {
+            const volatile uint16_t* attributes = oam + (index * 4);
+            bool hidden = (attributes[0] & 0x0300) == 0x0200;
+
+            if(! hidden && (attributes[2] & 0x03FF) == tiles_id)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+};
+
+#endif
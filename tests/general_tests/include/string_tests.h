@@ -6,7 +6,10 @@
 #ifndef STRING_TESTS_H
 #define STRING_TESTS_H
 
+#include "bn_fixed.h"
+#include "bn_limits.h"
 #include "bn_string.h"
+#include "bn_sstream.h"
 #include "tests.h"
 
 class string_tests : public tests
@@ -33,6 +36,30 @@ public:
 
         string = bn::to_string<32>(-9012345678);
         BN_ASSERT(string == bn::string_view("-9012345678"), string);
+
+        string = bn::to_string<32>(bn::numeric_limits<int>::min());
+        BN_ASSERT(string == bn::string_view("-2147483648"), string);
+
+        string = bn::to_string<32>(bn::numeric_limits<uint64_t>::max());
+        BN_ASSERT(string == bn::string_view("18446744073709551615"), string);
+
+        string.clear();
+
+        bn::ostringstream stream(string);
+        stream.append_padded(42, 6);
+        BN_ASSERT(string == bn::string_view("000042"), string);
+
+        string.clear();
+        stream.append_padded(-1234, 2);
+        BN_ASSERT(string == bn::string_view("-1234"), string);
+
+        string.clear();
+        stream.append_fixed(bn::fixed(-2.75), 3);
+        BN_ASSERT(string == bn::string_view("-2.750"), string);
+
+        string.clear();
+        stream.append_fixed(bn::fixed(12.5), 0);
+        BN_ASSERT(string == bn::string_view("12"), string);
     }
 };
 
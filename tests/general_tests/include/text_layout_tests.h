@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef TEXT_LAYOUT_TESTS_H
+#define TEXT_LAYOUT_TESTS_H
+
+#include "bn_text_layout.h"
+#include "tests.h"
+
+#include "common_fixed_8x16_sprite_font.h"
+
+class text_layout_tests : public tests
+{
+
+public:
+    text_layout_tests() :
+        tests("text_layout")
+    {
+        using alignment_type = bn::text_layout::alignment_type;
+
+        bn::text_layout layout(common::fixed_8x16_sprite_font, "ab cd\nefghij", 24, alignment_type::RIGHT);
+        BN_ASSERT(layout.lines_count() == 4);
+        BN_ASSERT(layout.characters_count() == 12);
+        BN_ASSERT(layout.line_text(0) == "ab");
+        BN_ASSERT(layout.line_text(1) == "cd");
+        BN_ASSERT(layout.line_text(2) == "efg");
+        BN_ASSERT(layout.line_text(3) == "hij");
+        BN_ASSERT(layout.lines()[0].width == 16);
+        BN_ASSERT(layout.lines()[0].x == 8);
+        BN_ASSERT(layout.lines()[2].x == 0);
+
+        BN_ASSERT(layout.line_index(2) == 0);
+        BN_ASSERT(layout.line_index(3) == 1);
+        BN_ASSERT(layout.line_index(5) == 1);
+        BN_ASSERT(layout.line_index(9) == 3);
+        BN_ASSERT(layout.line_text(1, 1) == "c");
+        BN_ASSERT(layout.line_text(3, 0).empty());
+        BN_ASSERT(layout.line_text(3, 100) == "hij");
+    }
+};
+
+#endif
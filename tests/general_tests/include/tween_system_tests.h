@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef TWEEN_SYSTEM_TESTS_H
+#define TWEEN_SYSTEM_TESTS_H
+
+#include "bn_math.h"
+#include "bn_tween_system.h"
+#include "tests.h"
+
+class tween_system_tests : public tests
+{
+
+public:
+    tween_system_tests() :
+        tests("tween_system")
+    {
+        static_assert(bn::tween_ease(bn::tween_easing_type::LINEAR, 0.25) == 0.25);
+        static_assert(bn::tween_ease(bn::tween_easing_type::QUAD_IN, 0.5) == 0.25);
+        static_assert(bn::tween_ease(bn::tween_easing_type::QUAD_OUT, 0.5) == 0.75);
+        static_assert(bn::tween_ease(bn::tween_easing_type::QUAD_IN_OUT, 0.25) == 0.125);
+        static_assert(bn::tween_ease(bn::tween_easing_type::CUBIC_IN, 0.5) == 0.125);
+        static_assert(bn::tween_ease(bn::tween_easing_type::CUBIC_OUT, 0.5) == 0.875);
+        static_assert(bn::tween_ease(bn::tween_easing_type::SMOOTH_STEP, 0.5) == 0.5);
+        static_assert(bn::tween_ease(bn::tween_easing_type::SMOOTH_STEP, 1) == 1);
+
+        bn::tween_system<int, bn::fixed, property_manager, 4> tweens;
+        properties[0] = 0;
+        properties[1] = 10;
+        properties[2] = -5;
+        tweens.add(0, 4, 8);
+        tweens.add(1, 2, 0, bn::tween_easing_type::QUAD_IN);
+        tweens.add(2, 8, 5, bn::tween_easing_type::SMOOTH_STEP);
+        BN_ASSERT(tweens.size() == 3);
+
+        tweens.update();
+        BN_ASSERT(properties[0] == 2, properties[0]);
+        BN_ASSERT(properties[1] == 7.5, properties[1]);
+
+        tweens.update();
+        BN_ASSERT(properties[1] == 0, properties[1]);
+        BN_ASSERT(tweens.size() == 2);
+
+        tweens.update();
+        tweens.update();
+        BN_ASSERT(properties[0] == 8, properties[0]);
+        BN_ASSERT(properties[2] == 0, properties[2]);
+        BN_ASSERT(tweens.size() == 1);
+
+        BN_ASSERT(tweens.remove(2) == 1);
+        BN_ASSERT(tweens.empty());
+
+        // Long durations and big deltas must not be quantized (errors must be lower than a progress unit):
+        properties[0] = 0;
+        tweens.add(0, 240, 240);
+
+        for(int update = 1; update < 240; ++update)
+        {
+            tweens.update();
+            BN_ASSERT(bn::abs(properties[0] - update) < bn::fixed::from_data(240), update, " - ", properties[0]);
+        }
+
+        tweens.update();
+        BN_ASSERT(properties[0] == 240, properties[0]);
+        BN_ASSERT(tweens.empty());
+
+        properties[0] = 0;
+        tweens.add(0, 3, 300);
+        tweens.update();
+        BN_ASSERT(bn::abs(properties[0] - 100) < bn::fixed::from_data(300), properties[0]);
+
+        tweens.update();
+        BN_ASSERT(bn::abs(properties[0] - 200) < bn::fixed::from_data(300), properties[0]);
+
+        tweens.update();
+        BN_ASSERT(properties[0] == 300, properties[0]);
+    }
+
+private:
+    inline static bn::fixed properties[3];
+
+    class property_manager
+    {
+
+    public:
+        [[nodiscard]] static bn::fixed get(int index)
+        {
+            return properties[index];
+        }
+
+        static void set(bn::fixed property, int index)
+        {
+            properties[index] = property;
+        }
+    };
+};
+
+#endif
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef UNORDERED_MAP_TESTS_H
+#define UNORDERED_MAP_TESTS_H
+
+#include "bn_unordered_map.h"
+#include "tests.h"
+
+class unordered_map_tests : public tests
+{
+
+public:
+    unordered_map_tests() :
+        tests("unordered_map")
+    {
+        // Keys 6, 14, 22 and 30 have the same home index (6), so they take indexes 6, 7, 0 and 1:
+        map_type map;
+        _insert_wrapped_cluster(map);
+        BN_ASSERT(map.begin()->first == 22, map.begin()->first);
+
+        // Erasing 6 shifts 22 (already visited) to the last index, so it must not be visited again:
+        int visits[4] = {};
+
+        for(auto it = map.begin(), end = map.end(); it != end; )
+        {
+            int key = it->first;
+            ++visits[key / 8];
+
+            if(key == 6)
+            {
+                it = map.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        for(int visit : visits)
+        {
+            BN_ASSERT(visit == 1, visit);
+        }
+
+        BN_ASSERT(map.size() == 3);
+        BN_ASSERT(! map.contains(6));
+        BN_ASSERT(map.contains(14));
+        BN_ASSERT(map.contains(22));
+        BN_ASSERT(map.contains(30));
+
+        // Same with erase_if:
+        map.clear();
+        _insert_wrapped_cluster(map);
+
+        int pred_calls = 0;
+        int erased_count = bn::erase_if(map, [&pred_calls](const map_type::value_type& value)
+        {
+            ++pred_calls;
+            return value.first == 6 || value.first == 14;
+        });
+
+        BN_ASSERT(erased_count == 2, erased_count);
+        BN_ASSERT(pred_calls == 4, pred_calls);
+        BN_ASSERT(map.size() == 2);
+        BN_ASSERT(map.contains(22));
+        BN_ASSERT(map.contains(30));
+
+        // Erasing all elements:
+        map.clear();
+        _insert_wrapped_cluster(map);
+        pred_calls = 0;
+        erased_count = bn::erase_if(map, [&pred_calls](const map_type::value_type&)
+        {
+            ++pred_calls;
+            return true;
+        });
+
+        BN_ASSERT(erased_count == 4, erased_count);
+        BN_ASSERT(pred_calls == 4, pred_calls);
+        BN_ASSERT(map.empty());
+    }
+
+private:
+    class key_hash
+    {
+
+    public:
+        [[nodiscard]] unsigned operator()(int key) const
+        {
+            return unsigned(key);
+        }
+    };
+
+    using map_type = bn::unordered_map<int, int, 8, key_hash>;
+
+    static void _insert_wrapped_cluster(map_type& map)
+    {
+        for(int key = 6; key < 32; key += 8)
+        {
+            map.insert(key, key);
+        }
+    }
+};
+
+#endif
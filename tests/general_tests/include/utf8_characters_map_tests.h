@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef UTF8_CHARACTERS_MAP_TESTS_H
+#define UTF8_CHARACTERS_MAP_TESTS_H
+
+#include "bn_utf8_characters_map.h"
+#include "tests.h"
+
+namespace utf8_characters_map_tests_detail
+{
+    constexpr bn::utf8_character utf8_characters[] = {
+        "Á", "É", "Í", "Ó", "Ú", "Ü", "Ñ", "á", "é", "í", "ó", "ú", "ü", "ñ", "¡", "¿",
+        "€", "Ω", "あ", "い", "う", "え", "お", "日", "本", "語", "😀"
+    };
+
+    constexpr bn::span<const bn::utf8_character> utf8_characters_span(utf8_characters);
+
+    constexpr auto utf8_characters_map = bn::utf8_characters_map<utf8_characters_span>();
+
+    constexpr bn::utf8_characters_map_ref utf8_characters_map_ref = utf8_characters_map.reference();
+
+    [[nodiscard]] constexpr bool valid_indexes()
+    {
+        for(int index = 0, limit = utf8_characters_span.size(); index < limit; ++index)
+        {
+            if(utf8_characters_map_ref.index(utf8_characters_span[index]) != index)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static_assert(utf8_characters_map_ref.size() == 27);
+    static_assert(utf8_characters_map_ref.index(bn::utf8_character("Á")) == 0);
+    static_assert(utf8_characters_map_ref.index(bn::utf8_character("¿")) == 15);
+    static_assert(utf8_characters_map_ref.index(bn::utf8_character("€")) == 16);
+    static_assert(utf8_characters_map_ref.index(bn::utf8_character("😀")) == 26);
+    static_assert(valid_indexes());
+}
+
+class utf8_characters_map_tests : public tests
+{
+
+public:
+    utf8_characters_map_tests() :
+        tests("utf8_characters_map")
+    {
+        using namespace utf8_characters_map_tests_detail;
+
+        BN_ASSERT(valid_indexes());
+        BN_ASSERT(utf8_characters_map_ref.index(bn::utf8_character("ñ")) == 13);
+        BN_ASSERT(utf8_characters_map_ref.index(bn::utf8_character("語")) == 25);
+    }
+};
+
+#endif
@@ -15,12 +15,25 @@
 #include "string_tests.h"
 #include "fixed_tests.h"
 #include "math_tests.h"
+#include "fast_division_tests.h"
 #include "sqrt_tests.h"
 #include "random_tests.h"
 #include "optional_tests.h"
 #include "any_tests.h"
 #include "format_tests.h"
 #include "memory_tests.h"
+#include "frame_arena_tests.h"
+#include "unordered_map_tests.h"
+#include "batch_math_tests.h"
+#include "sprite_text_tests.h"
+#include "bg_text_generator_tests.h"
+#include "sprite_tiles_tests.h"
+#include "sprite_affine_mats_tests.h"
+#include "sprite_animations_tests.h"
+#include "sprite_streamed_animate_actions_tests.h"
+#include "tween_system_tests.h"
+#include "text_layout_tests.h"
+#include "utf8_characters_map_tests.h"
 #include "sram_tests.h"
 
 #if ! BN_CFG_ASSERT_ENABLED
@@ -43,12 +56,25 @@ int main()
     string_tests();
     fixed_tests();
     math_tests();
+    fast_division_tests();
     sqrt_tests();
     random_tests();
     optional_tests();
     any_tests();
     format_tests();
     memory_tests memory_tests(used_stack_iwram);
+    frame_arena_tests();
+    unordered_map_tests();
+    batch_math_tests();
+    sprite_text_tests();
+    bg_text_generator_tests();
+    sprite_tiles_tests();
+    sprite_affine_mats_tests();
+    sprite_animations_tests();
+    sprite_streamed_animate_actions_tests();
+    tween_system_tests();
+    text_layout_tests();
+    utf8_characters_map_tests();
     sram_tests sram_tests;
 
     if(sram_tests.again())
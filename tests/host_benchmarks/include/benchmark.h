@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+// Keeps benchmark results alive, so the compiler can't remove the measured code:
+inline volatile unsigned benchmark_sink = 0;
+
+// Only benchmarks whose name contains this text are run (all of them if it is null):
+inline const char* benchmark_filter = nullptr;
+
+// Runs the given function some times and prints the best time per operation:
+template<typename Function>
+void benchmark(const char* name, int operations, Function&& function)
+{
+    constexpr int runs = 5;
+
+    if(benchmark_filter && ! std::strstr(name, benchmark_filter))
+    {
+        return;
+    }
+
+    double best_ns = 0;
+
+    for(int run = 0; run < runs; ++run)
+    {
+        auto start = std::chrono::steady_clock::now();
+        benchmark_sink = benchmark_sink + unsigned(function());
+
+        auto end = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(end - start).count();
+
+        if(! run || ns < best_ns)
+        {
+            best_ns = ns;
+        }
+    }
+
+    std::printf("%-48s %10.2f ns/op\n", name, best_ns / operations);
+}
+
+#endif
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_HOST_ASSERT_H
+#define BN_HOST_ASSERT_H
+
+// Host replacements of the butano assert macros (they are not redefined by bn_assert.h).
+// They only print the failed condition, since bn::ostringstream can't be built for the host.
+
+#include <cstdio>
+#include <cstdlib>
+
+#define BN_ASSERT(condition, ...) \
+    do \
+    { \
+        if(! (condition)) [[unlikely]] \
+        { \
+            std::fprintf(stderr, "ASSERT FAILED: %s (%s:%d)\n", #condition, __FILE__, __LINE__); \
+            std::abort(); \
+        } \
+    } while(false)
+
+#define BN_BASIC_ASSERT BN_ASSERT
+
+#define BN_ERROR(...) \
+    do \
+    { \
+        std::fprintf(stderr, "ERROR (%s:%d)\n", __FILE__, __LINE__); \
+        std::abort(); \
+    } while(false)
+
+#endif
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include <cmath>
+#include "bn_math.h"
+
+// Host replacements of the GBA BIOS math routines used by bn_math.h:
+
+namespace _bn
+{
+
+int sqrt_impl(int value)
+{
+    return int(std::sqrt(double(value)));
+}
+
+}
+
+namespace bn
+{
+
+fixed_t<16> atan2(int y, int x)
+{
+    BN_ASSERT(y >= -32767 && y <= 32767, "Invalid y: ", y);
+    BN_ASSERT(x >= -32767 && x <= 32767, "Invalid x: ", x);
+
+    double result = std::atan2(double(y), double(x)) / (2 * M_PI);
+    return fixed_t<16>::from_data(int(std::lround(result * 65536)));
+}
+
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include <cstring>
+#include "bn_memory.h"
+
+// Host replacements of the GBA memory routines used by bn::memory:
+
+namespace _bn::memory
+{
+
+void unsafe_copy_bytes(const void* source, int bytes, void* destination)
+{
+    std::memcpy(destination, source, size_t(bytes));
+}
+
+void unsafe_copy_half_words(const void* source, int half_words, void* destination)
+{
+    std::memcpy(destination, source, size_t(half_words) * 2);
+}
+
+void unsafe_copy_words(const void* source, int words, void* destination)
+{
+    std::memcpy(destination, source, size_t(words) * 4);
+}
+
+void unsafe_clear_bytes(int bytes, void* destination)
+{
+    std::memset(destination, 0, size_t(bytes));
+}
+
+void unsafe_clear_half_words(int half_words, void* destination)
+{
+    std::memset(destination, 0, size_t(half_words) * 2);
+}
+
+void unsafe_clear_words(int words, void* destination)
+{
+    std::memset(destination, 0, size_t(words) * 4);
+}
+
+}
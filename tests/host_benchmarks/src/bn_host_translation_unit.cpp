@@ -0,0 +1,10 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+// Butano sources which don't depend on the GBA hardware:
+
+#include "../../../butano/src/bn_generic_pool.cpp.h"
+#include "../../../butano/src/bn_reciprocal_lut.cpp.h"
+#include "../../../butano/src/bn_sin_lut.cpp.h"
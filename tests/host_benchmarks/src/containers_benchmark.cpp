@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_list.h"
+#include "bn_pool.h"
+#include "bn_deque.h"
+#include "bn_bitset.h"
+#include "bn_vector.h"
+#include "bn_forward_list.h"
+#include "bn_generic_pool.h"
+#include "bn_unordered_set.h"
+#include "bn_intrusive_list.h"
+
+#include "benchmark.h"
+
+namespace
+{
+    constexpr int max_size = 256;
+    constexpr int its = 256;
+    constexpr int operations = max_size * its;
+
+    struct node_type : bn::intrusive_list_node_type
+    {
+        int value = 0;
+    };
+
+    void _vector_benchmark()
+    {
+        auto vector = new bn::vector<int, max_size>();
+
+        benchmark("vector push_back + clear", operations, [&]{
+            for(int it = 0; it < its; ++it)
+            {
+                vector->clear();
+
+                for(int index = 0; index < max_size; ++index)
+                {
+                    vector->push_back(index);
+                }
+            }
+
+            return vector->back();
+        });
+
+        benchmark("vector iterate", operations, [&]{
+            int result = 0;
+
+            for(int it = 0; it < its; ++it)
+            {
+                for(int value : *vector)
+                {
+                    result += value;
+                }
+            }
+
+            return result;
+        });
+
+        benchmark("vector erase front + push_back", operations, [&]{
+            for(int index = 0; index < operations; ++index)
+            {
+                vector->erase(vector->begin());
+                vector->push_back(index);
+            }
+
+            return vector->front();
+        });
+
+        delete vector;
+    }
+
+    void _deque_benchmark()
+    {
+        auto deque = new bn::deque<int, max_size>();
+
+        benchmark("deque push_back + pop_front", operations, [&]{
+            for(int index = 0; index < operations; ++index)
+            {
+                if(deque->full())
+                {
+                    deque->pop_front();
+                }
+
+                deque->push_back(index);
+            }
+
+            return deque->front();
+        });
+
+        benchmark("deque iterate", operations, [&]{
+            int result = 0;
+
+            for(int it = 0; it < its; ++it)
+            {
+                for(int value : *deque)
+                {
+                    result += value;
+                }
+            }
+
+            return result;
+        });
+
+        delete deque;
+    }
+
+    void _list_benchmark()
+    {
+        auto list = new bn::list<int, max_size>();
+
+        benchmark("list push_back + pop_front", operations, [&]{
+            for(int index = 0; index < operations; ++index)
+            {
+                if(list->full())
+                {
+                    list->pop_front();
+                }
+
+                list->push_back(index);
+            }
+
+            return list->front();
+        });
+
+        benchmark("list iterate", operations, [&]{
+            int result = 0;
+
+            for(int it = 0; it < its; ++it)
+            {
+                for(int value : *list)
+                {
+                    result += value;
+                }
+            }
+
+            return result;
+        });
+
+        delete list;
+
+        auto forward_list = new bn::forward_list<int, max_size>();
+
+        benchmark("forward_list push_front + pop_front", operations, [&]{
+            for(int index = 0; index < operations; ++index)
+            {
+                if(forward_list->full())
+                {
+                    forward_list->pop_front();
+                }
+
+                forward_list->push_front(index);
+            }
+
+            return forward_list->front();
+        });
+
+        delete forward_list;
+
+        auto nodes = new node_type[max_size];
+        bn::intrusive_list<node_type> intrusive_list;
+
+        benchmark("intrusive_list push_back + pop_front", operations, [&]{
+            for(int index = 0; index < operations; ++index)
+            {
+                if(intrusive_list.size() == max_size)
+                {
+                    intrusive_list.pop_front();
+                }
+
+                node_type& node = nodes[index % max_size];
+                node.value = index;
+                intrusive_list.push_back(node);
+            }
+
+            return intrusive_list.front().value;
+        });
+
+        intrusive_list.clear();
+        delete[] nodes;
+    }
+
+    void _pool_benchmark()
+    {
+        auto pool = new bn::pool<int, max_size>();
+        auto pointers = new int*[max_size];
+
+        benchmark("pool create + destroy", operations, [&]{
+            int result = 0;
+
+            for(int it = 0; it < its; ++it)
+            {
+                for(int index = 0; index < max_size; ++index)
+                {
+                    pointers[index] = &pool->create(index);
+                }
+
+                for(int index = 0; index < max_size; ++index)
+                {
+                    result += *pointers[index];
+                    pool->destroy(*pointers[index]);
+                }
+            }
+
+            return result;
+        });
+
+        delete pool;
+
+        auto generic_pool = new bn::generic_pool<sizeof(int), max_size>();
+
+        benchmark("generic_pool create + destroy", operations, [&]{
+            int result = 0;
+
+            for(int it = 0; it < its; ++it)
+            {
+                for(int index = 0; index < max_size; ++index)
+                {
+                    pointers[index] = &generic_pool->create<int>(index);
+                }
+
+                for(int index = 0; index < max_size; ++index)
+                {
+                    result += *pointers[index];
+                    generic_pool->destroy(*pointers[index]);
+                }
+            }
+
+            return result;
+        });
+
+        delete generic_pool;
+        delete[] pointers;
+    }
+
+    void _unordered_set_benchmark()
+    {
+        auto set = new bn::unordered_set<int, max_size * 2>();
+
+        for(int index = 0; index < max_size; ++index)
+        {
+            set->insert(index * 7);
+        }
+
+        benchmark("unordered_set contains (hit and miss)", operations, [&]{
+            int result = 0;
+
+            for(int index = 0; index < operations; ++index)
+            {
+                result += set->contains(index % (max_size * 14));
+            }
+
+            return result;
+        });
+
+        delete set;
+    }
+
+    void _bitset_benchmark()
+    {
+        bn::bitset<max_size> bitset;
+
+        benchmark("bitset set + count", operations, [&]{
+            int result = 0;
+
+            for(int it = 0; it < its; ++it)
+            {
+                for(int index = 0; index < max_size; ++index)
+                {
+                    bitset.set(index, (index * it) & 1);
+                }
+
+                result += bitset.count();
+            }
+
+            return result;
+        });
+    }
+}
+
+void containers_benchmark()
+{
+    _vector_benchmark();
+    _deque_benchmark();
+    _list_benchmark();
+    _pool_benchmark();
+    _unordered_set_benchmark();
+    _bitset_benchmark();
+}
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "benchmark.h"
+
+void containers_benchmark();
+void unordered_map_benchmark();
+void math_benchmark();
+
+int main(int argc, char** argv)
+{
+    if(argc > 1)
+    {
+        benchmark_filter = argv[1];
+    }
+
+    containers_benchmark();
+    unordered_map_benchmark();
+    math_benchmark();
+    return 0;
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_math.h"
+#include "bn_fast_divider.h"
+
+#include "benchmark.h"
+
+namespace
+{
+    constexpr int operations = 1 << 16;
+
+    volatile int divisor_source = 321;
+}
+
+void math_benchmark()
+{
+    benchmark("fixed multiplication", operations, []{
+        bn::fixed result = 1;
+        bn::fixed multiplier = 1.0001;
+
+        for(int index = 0; index < operations; ++index)
+        {
+            result = (result * multiplier) + bn::fixed::from_data(index & 7);
+        }
+
+        return result.data();
+    });
+
+    benchmark("fixed division", operations, []{
+        bn::fixed result;
+        bn::fixed dividend = 1234.5;
+
+        for(int index = 0; index < operations; ++index)
+        {
+            result += dividend.division(bn::fixed::from_data(index + 4096));
+        }
+
+        return result.data();
+    });
+
+    benchmark("fixed safe_division", operations, []{
+        bn::fixed result;
+        bn::fixed dividend = 1234.5;
+
+        for(int index = 0; index < operations; ++index)
+        {
+            result += dividend.safe_division(bn::fixed::from_data(index + 4096));
+        }
+
+        return result.data();
+    });
+
+    benchmark("fast_division", operations, []{
+        bn::fixed result;
+        bn::fixed dividend = 1234.5;
+
+        for(int index = 0; index < operations; ++index)
+        {
+            result += bn::fast_division(dividend, bn::fixed::from_data(index + 4096));
+        }
+
+        return result.data();
+    });
+
+    benchmark("int division (same divisor)", operations, []{
+        int result = 0;
+        int divisor = divisor_source;
+
+        for(int index = 0; index < operations; ++index)
+        {
+            result += (index * 12345) / divisor;
+        }
+
+        return result;
+    });
+
+    benchmark("fast_divider (same divisor)", operations, []{
+        int result = 0;
+        bn::fast_divider divider(divisor_source);
+
+        for(int index = 0; index < operations; ++index)
+        {
+            result += divider.divide(index * 12345);
+        }
+
+        return result;
+    });
+
+    benchmark("sqrt", operations, []{
+        int result = 0;
+
+        for(int index = 0; index < operations; ++index)
+        {
+            result += bn::sqrt(index);
+        }
+
+        return result;
+    });
+
+    benchmark("lut_sin + lut_cos", operations, []{
+        bn::fixed result;
+
+        for(int index = 0; index < operations; ++index)
+        {
+            result += bn::lut_sin(index & 2047) + bn::lut_cos(index & 2047);
+        }
+
+        return result.data();
+    });
+}
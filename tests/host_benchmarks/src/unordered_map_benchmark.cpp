@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_unordered_map.h"
+
+#include <random>
+#include <unordered_map>
+#include "benchmark.h"
+
+namespace
+{
+    constexpr int max_size = 1024;
+    constexpr int lookups = 1 << 16;
+
+    using map_type = bn::unordered_map<unsigned, unsigned, max_size>;
+
+    void _check(const map_type& map, const std::unordered_map<unsigned, unsigned>& reference)
+    {
+        BN_ASSERT(map.size() == int(reference.size()));
+
+        for(const auto& [key, value] : reference)
+        {
+            auto it = map.find(key);
+            BN_ASSERT(it != map.end() && it->second == value);
+        }
+    }
+
+    // Checks the map against std::unordered_map with random insertions and erasures:
+    void _validate()
+    {
+        std::mt19937 random(1);
+        map_type map;
+        std::unordered_map<unsigned, unsigned> reference;
+
+        for(int it = 0; it < 200000; ++it)
+        {
+            unsigned key = random() % (max_size * 2);
+
+            if(random() % 2)
+            {
+                if(int(reference.size()) < max_size || reference.count(key))
+                {
+                    map[key] = unsigned(it);
+                    reference[key] = unsigned(it);
+                }
+            }
+            else
+            {
+                BN_ASSERT(map.erase(key) == bool(reference.erase(key)));
+            }
+
+            if(it % 1000 == 0)
+            {
+                _check(map, reference);
+            }
+        }
+
+        _check(map, reference);
+    }
+
+    void _benchmark(int load_factor)
+    {
+        std::mt19937 random(load_factor);
+        auto map = new map_type();
+        int size = (max_size * load_factor) / 100;
+        unsigned keys[max_size];
+        unsigned missing_keys[max_size];
+
+        for(int index = 0; index < size; ++index)
+        {
+            unsigned key;
+
+            do
+            {
+                key = random();
+            }
+            while(map->contains(key));
+
+            keys[index] = key;
+            map->insert(key, key);
+        }
+
+        for(int index = 0; index < max_size; ++index)
+        {
+            unsigned key;
+
+            do
+            {
+                key = random();
+            }
+            while(map->contains(key));
+
+            missing_keys[index] = key;
+        }
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "unordered_map find hit (load %d%%)", load_factor);
+        benchmark(name, lookups, [&]{
+            unsigned result = 0;
+
+            for(int index = 0; index < lookups; ++index)
+            {
+                result += map->find(keys[index % size])->second;
+            }
+
+            return result;
+        });
+
+        std::snprintf(name, sizeof(name), "unordered_map find miss (load %d%%)", load_factor);
+        benchmark(name, lookups, [&]{
+            unsigned result = 0;
+
+            for(int index = 0; index < lookups; ++index)
+            {
+                result += map->contains(missing_keys[index % max_size]);
+            }
+
+            return result;
+        });
+
+        std::snprintf(name, sizeof(name), "unordered_map erase + insert (load %d%%)", load_factor);
+        benchmark(name, lookups, [&]{
+            unsigned result = 0;
+
+            for(int index = 0; index < lookups; ++index)
+            {
+                unsigned key = keys[index % size];
+                result += map->erase(key);
+                map->insert(key, key);
+            }
+
+            return result;
+        });
+
+        delete map;
+    }
+}
+
+void unordered_map_benchmark()
+{
+    _validate();
+
+    for(int load_factor : { 50, 75, 90, 100 })
+    {
+        _benchmark(load_factor);
+    }
+}
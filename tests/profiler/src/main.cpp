@@ -7,17 +7,30 @@
 #include "bn_core.h"
 #include "bn_math.h"
 #include "bn_random.h"
+#include "bn_string.h"
+#include "bn_vector.h"
 #include "bn_profiler.h"
+#include "bn_camera_ptr.h"
+#include "bn_sprite_ptr.h"
+#include "bn_batch_math.h"
+#include "bn_fast_divider.h"
 #include "bn_unique_ptr.h"
 #include "bn_seed_random.h"
 
 #include "../../butano/hw/include/bn_hw_dma.h"
 #include "../../butano/hw/include/bn_hw_memory.h"
 #include "../../butano/hw/include/bn_hw_decompress.h"
+#include "../../butano/src/bn_cameras_manager.h"
+
+extern "C"
+{
+    #include "../../butano/hw/3rd_party/posprintf/include/posprintf.h"
+}
 
 #include "bn_regular_bg_items_butano_huge_rl.h"
 #include "bn_regular_bg_items_butano_huge_huff.h"
 #include "bn_regular_bg_items_butano_huge_lz77.h"
+#include "bn_sprite_items_common_variable_8x8_font.h"
 
 namespace
 {
@@ -59,6 +72,73 @@ void div_test(int& integer)
     }
 }
 
+void fast_divider_test(int& integer)
+{
+    // The divisor is not known at compile time, so the regular division can't be replaced with a multiplication:
+    int divisor = integer | 1;
+
+    int div_result = 0;
+    BN_PROFILER_START("div_same_regular");
+
+    for(int i = 0; i < its; ++i)
+    {
+        div_result += (i * 12345) / divisor;
+    }
+
+    BN_PROFILER_STOP();
+
+    bn::fast_divider divider(divisor);
+    int fast_divider_result = 0;
+    BN_PROFILER_START("div_same_fast_divider");
+
+    for(int i = 0; i < its; ++i)
+    {
+        fast_divider_result += divider.divide(i * 12345);
+    }
+
+    BN_PROFILER_STOP();
+
+    BN_ASSERT(div_result == fast_divider_result, "Invalid division");
+    integer += fast_divider_result;
+}
+
+void fixed_div_test(int& integer)
+{
+    bn::fixed dividend = bn::fixed::from_data(integer & 0xFFFFFF);
+
+    bn::fixed div_result;
+    BN_PROFILER_START("fixed_div_regular");
+
+    for(int i = 0; i < its; ++i)
+    {
+        div_result += dividend.division(bn::fixed::from_data(i + 4096));
+    }
+
+    BN_PROFILER_STOP();
+
+    bn::fixed safe_div_result;
+    BN_PROFILER_START("fixed_div_safe");
+
+    for(int i = 0; i < its; ++i)
+    {
+        safe_div_result += dividend.safe_division(bn::fixed::from_data(i + 4096));
+    }
+
+    BN_PROFILER_STOP();
+
+    bn::fixed fast_div_result;
+    BN_PROFILER_START("fixed_div_fast");
+
+    for(int i = 0; i < its; ++i)
+    {
+        fast_div_result += bn::fast_division(dividend, bn::fixed::from_data(i + 4096));
+    }
+
+    BN_PROFILER_STOP();
+
+    integer += div_result.data() + safe_div_result.data() + fast_div_result.data();
+}
+
 void sqrt_test(int& integer)
 {
     int sqrt_result = 0;
@@ -179,6 +259,118 @@ void atan2_test(int& integer)
     BN_PROFILER_STOP();
 }
 
+void to_string_test(int& integer)
+{
+    char buffer[32];
+    int posprintf_result = 0;
+    BN_PROFILER_START("to_string_posprintf");
+
+    for(int i = 0; i < its; ++i)
+    {
+        posprintf(buffer, "%l", long(i * 9973));
+        posprintf_result += buffer[0];
+    }
+
+    BN_PROFILER_STOP();
+
+    bn::string<32> string;
+    bn::ostringstream stream(string);
+    int stream_result = 0;
+    BN_PROFILER_START("to_string_stream");
+
+    for(int i = 0; i < its; ++i)
+    {
+        string.clear();
+        stream.append(i * 9973);
+        stream_result += string[0];
+    }
+
+    BN_PROFILER_STOP();
+
+    BN_ASSERT(posprintf_result == stream_result, "Invalid to_string");
+
+    BN_PROFILER_START("to_string_fixed");
+
+    for(int i = 0; i < its; ++i)
+    {
+        string.clear();
+        stream.append_fixed(bn::fixed::from_data(i * 9973), 3);
+        stream_result += string[0];
+    }
+
+    BN_PROFILER_STOP();
+
+    integer += posprintf_result;
+    integer += stream_result;
+}
+
+void batch_math_test(int& integer)
+{
+    constexpr int points_count = 1024;
+    constexpr int batch_its = its / points_count;
+
+    bn::unique_ptr<bn::array<bn::fixed_point, points_count>> points_ptr(new bn::array<bn::fixed_point, points_count>());
+    bn::span<bn::fixed_point> points(*points_ptr);
+    bn::fixed a = 0.75;
+    bn::fixed b = -0.5;
+    bn::fixed c = 0.5;
+    bn::fixed d = 0.75;
+    bn::fixed_point translation(1, 2);
+
+    for(int i = 0; i < points_count; ++i)
+    {
+        points[i] = bn::fixed_point(i % 64, i / 64);
+    }
+
+    BN_PROFILER_START("transform_scalar");
+
+    for(int it = 0; it < batch_its; ++it)
+    {
+        for(bn::fixed_point& point : points)
+        {
+            bn::fixed x = point.x();
+            bn::fixed y = point.y();
+            point = bn::fixed_point((a * x) + (b * y), (c * x) + (d * y)) + translation;
+        }
+    }
+
+    BN_PROFILER_STOP();
+
+    BN_PROFILER_START("transform_batch");
+
+    for(int it = 0; it < batch_its; ++it)
+    {
+        bn::batch_math::transform(a, b, c, d, translation, points, points);
+    }
+
+    BN_PROFILER_STOP();
+
+    bn::fixed dot_result;
+    BN_PROFILER_START("multiply_add_scalar");
+
+    for(int it = 0; it < batch_its; ++it)
+    {
+        for(const bn::fixed_point& point : points)
+        {
+            dot_result += (point.x() * point.x()) + (point.y() * point.y());
+        }
+    }
+
+    BN_PROFILER_STOP();
+
+    bn::span<const bn::fixed> values(reinterpret_cast<const bn::fixed*>(points.data()), points_count * 2);
+    BN_PROFILER_START("multiply_add_batch");
+
+    for(int it = 0; it < batch_its; ++it)
+    {
+        dot_result += bn::batch_math::dot(values, values);
+    }
+
+    BN_PROFILER_STOP();
+
+    integer += points[points_count - 1].x().data() + dot_result.data();
+}
+
 
 class std_coroutine_task
 {
@@ -478,21 +670,57 @@ void huff_decomp_test()
 
 }
 
+template<int WorldSprites, int HudSprites>
+void cameras_test(const char* id)
+{
+    bn::camera_ptr camera = bn::camera_ptr::create(0, 0);
+    bn::vector<bn::sprite_ptr, WorldSprites + HudSprites> sprites;
+
+    for(int index = 0; index < WorldSprites + HudSprites; ++index)
+    {
+        bn::sprite_ptr sprite = bn::sprite_items::common_variable_8x8_font.create_sprite(
+                    (index % 16) * 12 - 90, (index / 16) * 12 - 60);
+
+        if(index < WorldSprites)
+        {
+            sprite.set_camera(camera);
+        }
+
+        sprites.push_back(bn::move(sprite));
+    }
+
+    BN_PROFILER_START(id);
+
+    for(int i = 0; i < its_sqrt; ++i)
+    {
+        camera.set_x(i % 64);
+        bn::cameras_manager::update();
+    }
+
+    BN_PROFILER_STOP();
+}
+
 int main()
 {
     bn::core::init();
 
     int integer = 123456789;
     div_test(integer);
+    fast_divider_test(integer);
+    fixed_div_test(integer);
     sqrt_test(integer);
     random_test(integer);
     lut_sin_test(integer);
     atan2_test(integer);
+    to_string_test(integer);
+    batch_math_test(integer);
     coroutine_test(integer);
     copy_words_test();
     rl_decomp_test();
     lz77_decomp_test();
     huff_decomp_test();
+    cameras_test<16, 96>("cameras_16_world_96_hud");
+    cameras_test<96, 16>("cameras_96_world_16_hud");
 
     if(integer)
     {
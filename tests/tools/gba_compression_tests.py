@@ -0,0 +1,396 @@
+"""
+Copyright (c) 2020-2023 Gustavo Valiente gustavo.valiente@protonmail.com
+zlib License, see LICENSE file.
+
+Host tests of the compressed sizes estimated by butano/tools/gba_compression.py.
+
+grit is not needed: the estimated sizes are checked against hand encoded GBA BIOS streams and against the streams
+generated by the reference encoders of this file, which are decoded back with GBA BIOS compatible decoders.
+
+The auto compressions selected by butano/tools/butano_graphics_tool.py are checked with a fake grit which writes the
+streams generated by the reference encoders.
+
+Run them with `python3 gba_compression_tests.py`.
+"""
+
+import os
+import sys
+import heapq
+import random
+import tempfile
+import unittest
+from collections import Counter
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'butano', 'tools'))
+
+import gba_compression
+import butano_graphics_tool
+
+
+def align_4(data):
+    return bytes(data) + bytes((4 - (len(data) % 4)) % 4)
+
+
+def header(compression_type, size):
+    return bytes([compression_type]) + size.to_bytes(3, 'little')
+
+
+def lz77_encode(data):
+    # Brute force greedy encoder, VRAM safe (matches are never taken from the previous byte):
+    result = bytearray(header(0x10, len(data)))
+    index = 0
+
+    while index < len(data):
+        flags_index = len(result)
+        result.append(0)
+
+        for block in range(8):
+            if index >= len(data):
+                break
+
+            best_length = 0
+            best_distance = 0
+            max_length = min(18, len(data) - index)
+
+            for distance in range(2, min(4096, index) + 1):
+                length = 0
+
+                while length < max_length and data[index - distance + length] == data[index + length]:
+                    length += 1
+
+                if length > best_length:
+                    best_length = length
+                    best_distance = distance
+
+            if best_length >= 3:
+                result[flags_index] |= 0x80 >> block
+                disp = best_distance - 1
+                result.append(((best_length - 3) << 4) | (disp >> 8))
+                result.append(disp & 0xFF)
+                index += best_length
+            else:
+                result.append(data[index])
+                index += 1
+
+    return align_4(result)
+
+
+def lz77_decode(stream):
+    assert stream[0] == 0x10
+    size = int.from_bytes(stream[1:4], 'little')
+    result = bytearray()
+    index = 4
+
+    while len(result) < size:
+        flags = stream[index]
+        index += 1
+
+        for block in range(8):
+            if len(result) >= size:
+                break
+
+            if flags & (0x80 >> block):
+                length = (stream[index] >> 4) + 3
+                distance = (((stream[index] & 0xF) << 8) | stream[index + 1]) + 1
+                index += 2
+                assert distance >= 2
+
+                for _ in range(length):
+                    result.append(result[-distance])
+            else:
+                result.append(stream[index])
+                index += 1
+
+    return bytes(result)
+
+
+def run_length_encode(data):
+    result = bytearray(header(0x30, len(data)))
+    literals = bytearray()
+    index = 0
+
+    def flush_literals():
+        if literals:
+            result.append(len(literals) - 1)
+            result.extend(literals)
+            literals.clear()
+
+    while index < len(data):
+        run_length = 1
+
+        while run_length < 130 and index + run_length < len(data) and data[index + run_length] == data[index]:
+            run_length += 1
+
+        if run_length >= 3:
+            flush_literals()
+            result.append(0x80 | (run_length - 3))
+            result.append(data[index])
+            index += run_length
+        else:
+            literals.append(data[index])
+            index += 1
+
+            if len(literals) == 128:
+                flush_literals()
+
+    flush_literals()
+    return align_4(result)
+
+
+def run_length_decode(stream):
+    assert stream[0] == 0x30
+    size = int.from_bytes(stream[1:4], 'little')
+    result = bytearray()
+    index = 4
+
+    while len(result) < size:
+        flag = stream[index]
+        index += 1
+
+        if flag & 0x80:
+            result.extend(bytes([stream[index]]) * ((flag & 0x7F) + 3))
+            index += 1
+        else:
+            length = (flag & 0x7F) + 1
+            result.extend(stream[index:index + length])
+            index += length
+
+    return bytes(result)
+
+
+def huffman_encode(data):
+    frequencies = Counter(data)
+
+    if len(frequencies) == 1:
+        frequencies[(data[0] + 1) & 0xFF] = 0
+
+    heap = [(frequency, value, value) for value, frequency in frequencies.items()]
+    heapq.heapify(heap)
+    node_id = 256
+
+    while len(heap) > 1:
+        left = heapq.heappop(heap)
+        right = heapq.heappop(heap)
+        heapq.heappush(heap, (left[0] + right[0], node_id, (left[2], right[2])))
+        node_id += 1
+
+    root = heap[0][2]
+
+    def leaves_count(node):
+        return leaves_count(node[0]) + leaves_count(node[1]) if isinstance(node, tuple) else 1
+
+    # Node addresses start at 1 (after the tree size byte). The children pair of a node stored at address A is stored
+    # at address (A & ~1) + (offset * 2) + 2, with offset < 64. Pairs close to that limit are stored first, and
+    # otherwise pairs with less leaves are stored first to keep big subtrees close to their parents:
+    nodes = [root]
+    pending_pairs = [(0, root)]
+    parent_indexes = {}
+
+    def pair_offset(parent_index, children_index):
+        return (children_index + 1 - ((parent_index + 1) & ~1) - 2) // 2
+
+    def pair_slack(pending_pair):
+        return 63 - pair_offset(pending_pair[0], len(nodes))
+
+    while pending_pairs:
+        pending_pairs.sort(key=lambda pending_pair: (0, pending_pair[0]) if pair_slack(pending_pair) <= 8 else
+                           (1, leaves_count(pending_pair[1])))
+        parent_index, node = pending_pairs.pop(0)
+        parent_indexes[parent_index] = len(nodes)
+
+        for child_index, child in enumerate(node):
+            if isinstance(child, tuple):
+                pending_pairs.append((len(nodes) + child_index, child))
+
+        nodes.extend(node)
+
+    tree = bytearray()
+
+    for node_index, node in enumerate(nodes):
+        if isinstance(node, tuple):
+            offset = pair_offset(node_index, parent_indexes[node_index])
+            assert 0 <= offset < 64
+            tree.append(offset | (0 if isinstance(node[0], tuple) else 0x80) |
+                        (0 if isinstance(node[1], tuple) else 0x40))
+        else:
+            tree.append(node)
+
+    codes = {}
+
+    def assign_codes(node, code):
+        if isinstance(node, tuple):
+            assign_codes(node[0], code + '0')
+            assign_codes(node[1], code + '1')
+        else:
+            codes[node] = code
+
+    assign_codes(root, '')
+    tree_table = align_4(bytes([0]) + tree)
+    tree_table = bytes([(len(tree_table) // 2) - 1]) + tree_table[1:]
+    bits = ''.join(codes[value] for value in data)
+    bits += '0' * ((32 - (len(bits) % 32)) % 32)
+    words = b''.join(int(bits[index:index + 32], 2).to_bytes(4, 'little') for index in range(0, len(bits), 32))
+    return header(0x28, len(data)) + tree_table + words
+
+
+def huffman_decode(stream):
+    assert stream[0] == 0x28
+    size = int.from_bytes(stream[1:4], 'little')
+    tree_table_size = (stream[4] + 1) * 2
+    tree_index = 5
+    words_index = 4 + tree_table_size
+    result = bytearray()
+    node_index = tree_index
+
+    while len(result) < size:
+        word = int.from_bytes(stream[words_index:words_index + 4], 'little')
+        words_index += 4
+
+        for bit_index in range(31, -1, -1):
+            node = stream[node_index]
+            children_index = (node_index & ~1) + ((node & 0x3F) * 2) + 2
+            bit = (word >> bit_index) & 1
+            end_node = node & (0x40 if bit else 0x80)
+            node_index = children_index + bit
+
+            if end_node:
+                result.append(stream[node_index])
+                node_index = tree_index
+
+                if len(result) == size:
+                    break
+
+    return bytes(result)
+
+
+def test_data():
+    random_generator = random.Random(1234)
+    tile = bytes(random_generator.randrange(16) for _ in range(32))
+    skewed = bytes(int(random_generator.expovariate(0.03)) & 0xFF for _ in range(5000))
+    return [
+        bytes(1),
+        bytes([7, 7]),
+        bytes(256),
+        bytes(range(256)),
+        bytes(random_generator.randrange(256) for _ in range(1000)),
+        bytes(random_generator.randrange(4) for _ in range(2048)),
+        (tile * 40) + bytes(random_generator.randrange(16) for _ in range(640)) + (tile * 20),
+        bytes([1, 2, 3]) * 700 + bytes(300) + bytes([9]) * 140,
+        bytes((index * index) & 0xFF for index in range(5000)),
+        skewed,
+    ]
+
+
+class GBACompressionTests(unittest.TestCase):
+
+    def test_hand_encoded_streams(self):
+        streams = [
+            # 16 zeros: RLE run flag plus value:
+            (bytes(16), header(0x30, 16) + bytes([0x80 | 13, 0, 0, 0]),
+             gba_compression.run_length_compressed_size, run_length_decode),
+
+            # 1, 2, 3: RLE literals flag plus values:
+            (bytes([1, 2, 3]), header(0x30, 3) + bytes([2, 1, 2, 3]),
+             gba_compression.run_length_compressed_size, run_length_decode),
+
+            # 0, 1 repeated 8 times: two literals and a match of 14 bytes at distance 2:
+            (bytes([0, 1]) * 8, header(0x10, 16) + bytes([0x20, 0, 1, 0xB0, 0x01, 0, 0, 0]),
+             gba_compression.lz77_compressed_size, lz77_decode),
+
+            # 32 zeros: the previous byte can't be used, so one more literal is needed before the first match:
+            (bytes(32), header(0x10, 32) + bytes([0x30, 0, 0, 0xF0, 0x01, 0x90, 0x01, 0]),
+             gba_compression.lz77_compressed_size, lz77_decode),
+
+            # 0, 0, 1: two leaves tree, one bit per value:
+            (bytes([0, 0, 1]), header(0x28, 3) + bytes([1, 0xC0, 0, 1]) + (0x20000000).to_bytes(4, 'little'),
+             gba_compression.huffman_compressed_size, huffman_decode),
+        ]
+
+        for data, stream, compressed_size, decode in streams:
+            self.assertEqual(decode(stream), data)
+            self.assertEqual(compressed_size(data), len(stream))
+
+    def test_lz77(self):
+        for data in test_data():
+            stream = lz77_encode(data)
+            self.assertEqual(lz77_decode(stream), data)
+            self.assertEqual(gba_compression.lz77_compressed_size(data), len(stream))
+            self.assertEqual(gba_compression.compressed_size('lz77', data), len(stream))
+
+    def test_run_length(self):
+        for data in test_data():
+            stream = run_length_encode(data)
+            self.assertEqual(run_length_decode(stream), data)
+            self.assertEqual(gba_compression.run_length_compressed_size(data), len(stream))
+            self.assertEqual(gba_compression.compressed_size('run_length', data), len(stream))
+
+    def test_huffman(self):
+        for data in test_data():
+            stream = huffman_encode(data)
+            self.assertEqual(huffman_decode(stream), data)
+            self.assertEqual(gba_compression.huffman_compressed_size(data), len(stream))
+            self.assertEqual(gba_compression.compressed_size('huffman', data), len(stream))
+
+    def test_none(self):
+        for data in test_data():
+            self.assertEqual(gba_compression.compressed_size('none', data), len(align_4(data)))
+
+
+class AutoCompressionTests(unittest.TestCase):
+
+    encoders = {
+        'none': align_4,
+        'lz77': lz77_encode,
+        'run_length': run_length_encode,
+        'huffman': huffman_encode,
+    }
+
+    def process_compressions(self, data, compression, encoders):
+        # Fake grit: writes the given data with the requested compression to the assembly file:
+        grit_compressions = []
+
+        with tempfile.TemporaryDirectory() as build_folder_path:
+            def execute_command(grit_compression):
+                grit_compressions.append(grit_compression)
+                butano_graphics_tool.write_grit_assembly(
+                    build_folder_path + '/test_bn_gfx.s', 'test',
+                    [('test_bn_gfxTiles', encoders[grit_compression](data))])
+
+            result, = butano_graphics_tool.process_compressions([compression], ['Tiles'], build_folder_path, 'test',
+                                                                execute_command)
+
+        return result, grit_compressions
+
+    def test_selected_compression_is_the_smallest(self):
+        for compression in ['auto', 'auto_no_huffman']:
+            tested_compressions = ['none', 'run_length', 'lz77']
+
+            if compression == 'auto':
+                tested_compressions.append('huffman')
+
+            for data in test_data():
+                result, grit_compressions = self.process_compressions(align_4(data), compression, self.encoders)
+                self.assertIn(result, tested_compressions)
+                self.assertLessEqual(len(grit_compressions), 2)
+                self.assertEqual(grit_compressions[-1], result)
+
+                result_size = len(self.encoders[result](align_4(data)))
+
+                for tested_compression in tested_compressions:
+                    self.assertLessEqual(result_size, len(self.encoders[tested_compression](align_4(data))))
+
+    def test_bigger_grit_output_is_not_compressed(self):
+        # grit output bigger than estimated and than the uncompressed data:
+        encoders = {compression: (lambda data, encoder=encoder: encoder(data) + bytes(len(data)))
+                    for compression, encoder in self.encoders.items() if compression != 'none'}
+        encoders['none'] = align_4
+        data = bytes(256)
+        result, grit_compressions = self.process_compressions(data, 'auto', encoders)
+        self.assertEqual(result, 'none')
+        self.assertEqual(len(grit_compressions), 3)
+        self.assertNotEqual(grit_compressions[1], 'none')
+        self.assertEqual(grit_compressions[2], 'none')
+
+
+if __name__ == '__main__':
+    unittest.main()